@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "../s21_arena.h"
+#include "../s21_list.h"
+#include "../s21_map.h"
+
+// Teardown of large node based containers: the heap runs free every node,
+// the arena runs drop the root and hand the chunks back with release().
+// Only the teardown is timed; each iteration builds a fresh container first.
+
+using HeapMap = s21::Map<int, int>;
+using ArenaMap = s21::Map<int, int, std::less<int>,
+                          s21::ArenaAllocator<std::pair<const int, int>>>;
+
+template <typename MapType>
+static void Fill(MapType& m, int n) {
+  for (int i = 0; i < n; ++i) m.insert(m.end(), {i, i});
+}
+
+static void BM_MapTeardownHeap(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto m = std::make_unique<HeapMap>();
+    Fill(*m, n);
+    state.ResumeTiming();
+    m.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_MapTeardownHeap)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+template <bool HugePages>
+static void BM_MapTeardownArena(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto arena = std::make_unique<s21::Arena>(size_t{64} << 20, HugePages);
+    auto m = std::make_unique<ArenaMap>(arena.get());
+    Fill(*m, n);
+    state.ResumeTiming();
+    m.reset();
+    arena.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_MapTeardownArena, false)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MapTeardownArena, true)
+    ->Arg(1 << 20)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+// building, for scale: the tree work dominates and both take about as long
+static void BM_MapBuildHeap(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    HeapMap m;
+    Fill(m, n);
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_MapBuildHeap)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_MapBuildArena(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Arena arena(size_t{64} << 20, true);
+    ArenaMap m(&arena);
+    Fill(m, n);
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_MapBuildArena)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+template <bool InArena>
+static void BM_ListTeardown(benchmark::State& state) {
+  using ListType = std::conditional_t<InArena,
+                                      s21::List<int, s21::ArenaAllocator<int>>,
+                                      s21::List<int>>;
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Arena arena(size_t{64} << 20);
+    std::unique_ptr<ListType> l;
+    if constexpr (InArena) {
+      l = std::make_unique<ListType>(&arena);
+    } else {
+      l = std::make_unique<ListType>();
+    }
+    for (int i = 0; i < n; ++i) l->push_back(i);
+    state.ResumeTiming();
+    l.reset();
+    arena.release();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_ListTeardown, false)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ListTeardown, true)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
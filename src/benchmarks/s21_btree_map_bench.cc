@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+#include "../s21_btree_map.h"
+#include "../s21_map.h"
+
+// Ordered index of n even keys, inserted in random order, at 1M, 10M and 50M
+// entries. The 50M runs need a few GB of memory for s21::Map.
+
+static std::vector<int> ShuffledKeys(int n) {
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i * 2;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+  return keys;
+}
+
+// building a 50M index takes a while, so each type keeps its last one
+template <typename MapType>
+static const MapType& Index(int n) {
+  static std::unique_ptr<MapType> index;
+  static int built = -1;
+  if (built != n) {
+    index.reset();
+    index = std::make_unique<MapType>();
+    for (int key : ShuffledKeys(n)) index->insert({key, key});
+    built = n;
+  }
+  return *index;
+}
+
+static void IndexSizes(benchmark::internal::Benchmark* b) {
+  b->Arg(1000000)->Arg(10000000)->Arg(50000000);
+}
+
+template <typename MapType>
+static void BM_OrderedInsert(benchmark::State& state) {
+  const std::vector<int> keys = ShuffledKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    MapType m;
+    for (int key : keys) m.insert({key, key});
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(BM_OrderedInsert, s21::BTreeMap<int, int>)
+    ->Apply(IndexSizes)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OrderedInsert, s21::Map<int, int>)
+    ->Apply(IndexSizes)
+    ->Unit(benchmark::kMillisecond);
+
+// random point lookups, half of them for keys that are not there
+template <typename MapType>
+static void BM_OrderedLookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const MapType& m = Index<MapType>(n);
+  std::mt19937 gen(7);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.contains(static_cast<int>(gen() % n) * 2 +
+                                        static_cast<int>(gen() & 1)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_OrderedLookup, s21::BTreeMap<int, int>)
+    ->Apply(IndexSizes);
+BENCHMARK_TEMPLATE(BM_OrderedLookup, s21::Map<int, int>)->Apply(IndexSizes);
+
+// range scans: seek to a random key and read the next 1000 entries
+template <typename MapType>
+static void BM_OrderedScan(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const MapType& m = Index<MapType>(n);
+  std::mt19937 gen(7);
+  for (auto _ : state) {
+    long long sum = 0;
+    int taken = 0;
+    for (auto it = m.lower_bound(static_cast<int>(gen() % n) * 2);
+         it != m.end() && taken < 1000; ++it, ++taken) {
+      sum += it->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK_TEMPLATE(BM_OrderedScan, s21::BTreeMap<int, int>)
+    ->Apply(IndexSizes);
+BENCHMARK_TEMPLATE(BM_OrderedScan, s21::Map<int, int>)->Apply(IndexSizes);
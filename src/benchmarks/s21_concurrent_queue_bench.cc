@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "../s21_concurrent_queue.h"
+#include "../s21_queue.h"
+
+// Even thread indices produce and odd ones consume, so Threads(2 * k) runs k
+// producers against k consumers. Every thread does the same number of
+// iterations, which keeps pushes and pops balanced and lets the run drain.
+
+static const int kMaxThreads =
+    2 * static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+static s21::ConcurrentQueue<int> ring(1024);
+
+static void BM_ConcurrentQueue(benchmark::State& state) {
+  const bool producer = state.thread_index() % 2 == 0;
+  int value = 0;
+  for (auto _ : state) {
+    if (producer) {
+      while (!ring.try_push(value)) std::this_thread::yield();
+    } else {
+      while (!ring.try_pop(value)) std::this_thread::yield();
+    }
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentQueue)->ThreadRange(2, kMaxThreads)->UseRealTime();
+
+// The same traffic moved 32 items per claim.
+static void BM_ConcurrentQueueBulk(benchmark::State& state) {
+  const bool producer = state.thread_index() % 2 == 0;
+  int batch[32] = {};
+  for (auto _ : state) {
+    size_t done = 0;
+    while (done < 32) {
+      size_t n = producer ? ring.push_bulk(batch + done, batch + 32)
+                          : ring.pop_bulk(batch + done, 32 - done);
+      if (n == 0) std::this_thread::yield();
+      done += n;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 32);
+}
+BENCHMARK(BM_ConcurrentQueueBulk)->ThreadRange(2, kMaxThreads)->UseRealTime();
+
+// What we had before: s21::Queue behind one mutex.
+static std::mutex queue_mutex;
+static s21::Queue<int> locked_queue;
+
+static void BM_MutexQueue(benchmark::State& state) {
+  const bool producer = state.thread_index() % 2 == 0;
+  int value = 0;
+  for (auto _ : state) {
+    if (producer) {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      locked_queue.push(value);
+    } else {
+      while (true) {
+        {
+          std::lock_guard<std::mutex> lock(queue_mutex);
+          if (!locked_queue.empty()) {
+            value = locked_queue.front();
+            locked_queue.pop();
+            break;
+          }
+        }
+        std::this_thread::yield();
+      }
+    }
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexQueue)->ThreadRange(2, kMaxThreads)->UseRealTime();
@@ -0,0 +1,346 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <list>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <vector>
+
+#include "../s21_array.h"
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_multiset.h"
+#include "../s21_queue.h"
+#include "../s21_set.h"
+#include "../s21_stack.h"
+#include "../s21_vector.h"
+
+// Every container next to its std counterpart, same workload, same sizes.
+// Run with `make bench` and diff the JSON of two runs with compare.py from
+// Google Benchmark's tools directory:
+//   compare.py benchmarks before.json after.json
+
+// Key orders for the ordered containers: ascending, a random permutation,
+// and Zipf draws (s = 0.99) where a few hot keys repeat a lot, as request
+// traffic does. Zipf ranks are scattered so hot keys are not also the
+// smallest ones.
+enum Dist { kSorted, kRandom, kZipf };
+
+static std::vector<int> Keys(Dist dist, int n) {
+  std::vector<int> keys(n);
+  std::mt19937 gen(21);
+  if (dist == kZipf) {
+    std::vector<double> cdf(n);
+    double sum = 0;
+    for (int rank = 0; rank < n; ++rank) {
+      cdf[rank] = sum += 1.0 / std::pow(rank + 1, 0.99);
+    }
+    std::uniform_real_distribution<double> uniform(0, sum);
+    for (int& key : keys) {
+      auto rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(gen)) -
+                  cdf.begin();
+      key = static_cast<int>(static_cast<unsigned>(rank) * 2654435761u >> 1);
+    }
+    return keys;
+  }
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  if (dist == kRandom) std::shuffle(keys.begin(), keys.end(), gen);
+  return keys;
+}
+
+static void KeyedSizes(benchmark::internal::Benchmark* bench) {
+  for (int n : {1 << 10, 1 << 14, 1 << 18}) bench->Arg(n);
+}
+
+// The few calls whose shape differs between the two libraries. Containers
+// are taken by non-const reference: not every s21 lookup and begin() has a
+// const overload yet.
+template <typename C>
+static void Add(C& c, int key) {
+  c.insert(key);
+}
+template <typename K, typename T>
+static void Add(s21::Map<K, T>& m, int key) {
+  m.insert({key, key});
+}
+template <typename K, typename T>
+static void Add(std::map<K, T>& m, int key) {
+  m.insert({key, key});
+}
+
+template <typename C>
+static bool Has(C& c, int key) {
+  return c.find(key) != c.end();
+}
+template <typename K, typename T>
+static bool Has(s21::Map<K, T>& m, int key) {
+  return m.contains(key);
+}
+
+template <typename C>
+static long long Sum(C& c) {
+  long long sum = 0;
+  for (const auto& value : c) sum += value;
+  return sum;
+}
+template <typename K, typename T>
+static long long Sum(s21::Map<K, T>& m) {
+  long long sum = 0;
+  for (const auto& value : m) sum += value.second;
+  return sum;
+}
+template <typename K, typename T>
+static long long Sum(std::map<K, T>& m) {
+  long long sum = 0;
+  for (const auto& value : m) sum += value.second;
+  return sum;
+}
+
+//--------------------------------------------------------------------
+// Set, Multiset, Map
+//--------------------------------------------------------------------
+
+template <typename C, Dist D>
+static void BM_Insert(benchmark::State& state) {
+  const auto keys = Keys(D, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    C c;
+    for (int key : keys) Add(c, key);
+    benchmark::DoNotOptimize(c.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// looks the keys up again in the order they were inserted
+template <typename C, Dist D>
+static void BM_Find(benchmark::State& state) {
+  const auto keys = Keys(D, static_cast<int>(state.range(0)));
+  C c;
+  for (int key : keys) Add(c, key);
+  for (auto _ : state) {
+    for (int key : keys) benchmark::DoNotOptimize(Has(c, key));
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// erases every key present, one node per call, then rebuilds untimed
+template <typename C, Dist D>
+static void BM_Erase(benchmark::State& state) {
+  const auto keys = Keys(D, static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    for (int key : keys) Add(c, key);
+    state.ResumeTiming();
+    for (int key : keys) {
+      auto it = c.lower_bound(key);
+      if (it != c.end()) c.erase(it);
+    }
+    benchmark::DoNotOptimize(c.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// the insertion order decides where the nodes landed in memory
+template <typename C, Dist D>
+static void BM_Iterate(benchmark::State& state) {
+  const auto keys = Keys(D, static_cast<int>(state.range(0)));
+  C c;
+  for (int key : keys) Add(c, key);
+  for (auto _ : state) benchmark::DoNotOptimize(Sum(c));
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+using S21Set = s21::Set<int>;
+using StdSet = std::set<int>;
+using S21Multiset = s21::Multiset<int>;
+using StdMultiset = std::multiset<int>;
+using S21Map = s21::Map<int, int>;
+using StdMap = std::map<int, int>;
+
+// one line per operation and container, all three key orders each
+#define S21_KEYED_BENCH(op, type)                           \
+  BENCHMARK_TEMPLATE(op, type, kSorted)->Apply(KeyedSizes); \
+  BENCHMARK_TEMPLATE(op, type, kRandom)->Apply(KeyedSizes); \
+  BENCHMARK_TEMPLATE(op, type, kZipf)->Apply(KeyedSizes)
+
+S21_KEYED_BENCH(BM_Insert, S21Set);
+S21_KEYED_BENCH(BM_Insert, StdSet);
+S21_KEYED_BENCH(BM_Find, S21Set);
+S21_KEYED_BENCH(BM_Find, StdSet);
+S21_KEYED_BENCH(BM_Erase, S21Set);
+S21_KEYED_BENCH(BM_Erase, StdSet);
+S21_KEYED_BENCH(BM_Iterate, S21Set);
+S21_KEYED_BENCH(BM_Iterate, StdSet);
+
+S21_KEYED_BENCH(BM_Insert, S21Multiset);
+S21_KEYED_BENCH(BM_Insert, StdMultiset);
+S21_KEYED_BENCH(BM_Find, S21Multiset);
+S21_KEYED_BENCH(BM_Find, StdMultiset);
+S21_KEYED_BENCH(BM_Erase, S21Multiset);
+S21_KEYED_BENCH(BM_Erase, StdMultiset);
+S21_KEYED_BENCH(BM_Iterate, S21Multiset);
+S21_KEYED_BENCH(BM_Iterate, StdMultiset);
+
+S21_KEYED_BENCH(BM_Insert, S21Map);
+S21_KEYED_BENCH(BM_Insert, StdMap);
+S21_KEYED_BENCH(BM_Find, S21Map);
+S21_KEYED_BENCH(BM_Find, StdMap);
+S21_KEYED_BENCH(BM_Erase, S21Map);
+S21_KEYED_BENCH(BM_Erase, StdMap);
+S21_KEYED_BENCH(BM_Iterate, S21Map);
+S21_KEYED_BENCH(BM_Iterate, StdMap);
+
+#undef S21_KEYED_BENCH
+
+//--------------------------------------------------------------------
+// Vector, List, Stack, Queue, Array
+//--------------------------------------------------------------------
+
+static void SequenceSizes(benchmark::internal::Benchmark* bench) {
+  bench->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+// fills from empty, no reserve, then pops everything off the back
+template <typename C>
+static void BM_VectorPushPop(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    C c;
+    for (int i = 0; i < n; ++i) c.push_back(i);
+    while (!c.empty()) c.pop_back();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_VectorPushPop, s21::Vector<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_VectorPushPop, std::vector<int>)->Apply(SequenceSizes);
+
+// inserts and erases at the front, the worst place for a vector
+template <typename C>
+static void BM_VectorInsertErase(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  C c;
+  for (int i = 0; i < n; ++i) c.push_back(1);
+  for (auto _ : state) {
+    c.insert(c.begin(), 2);
+    c.erase(c.begin());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, s21::Vector<int>)
+    ->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, std::vector<int>)
+    ->Apply(SequenceSizes);
+
+template <typename C>
+static void BM_VectorFindIterate(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  C c;
+  for (int i = 0; i < n; ++i) c.push_back(i);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find(c.begin(), c.end(), n - 1));
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_VectorFindIterate, s21::Vector<int>)
+    ->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_VectorFindIterate, std::vector<int>)
+    ->Apply(SequenceSizes);
+
+template <typename C>
+static void BM_ListPushPopFront(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    C c;
+    for (int i = 0; i < n; ++i) c.push_back(i);
+    while (!c.empty()) c.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_ListPushPopFront, s21::List<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_ListPushPopFront, std::list<int>)->Apply(SequenceSizes);
+
+// inserts next to a node in the middle and erases the new node again
+template <typename C>
+static void BM_ListInsertErase(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  C c;
+  for (int i = 0; i < n; ++i) c.push_back(i);
+  auto middle = c.begin();
+  for (int i = 0; i < n / 2; ++i) ++middle;
+  for (auto _ : state) {
+    c.insert(middle, 0);
+    auto inserted = middle;
+    c.erase(--inserted);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_ListInsertErase, s21::List<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_ListInsertErase, std::list<int>)->Apply(SequenceSizes);
+
+template <typename C>
+static void BM_ListIterate(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  C c;
+  for (int i = 0; i < n; ++i) c.push_back(i);
+  for (auto _ : state) benchmark::DoNotOptimize(Sum(c));
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_ListIterate, s21::List<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_ListIterate, std::list<int>)->Apply(SequenceSizes);
+
+// std::stack and std::queue sit on std::deque; both of ours sit on s21::List
+template <typename C>
+static void BM_StackPushPop(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    C c;
+    for (int i = 0; i < n; ++i) c.push(i);
+    long long sum = 0;
+    while (!c.empty()) {
+      sum += c.top();
+      c.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_StackPushPop, s21::Stack<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::stack<int>)->Apply(SequenceSizes);
+
+template <typename C>
+static void BM_QueuePushPop(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    C c;
+    for (int i = 0; i < n; ++i) c.push(i);
+    long long sum = 0;
+    while (!c.empty()) {
+      sum += c.front();
+      c.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_QueuePushPop, s21::Queue<int>)->Apply(SequenceSizes);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, std::queue<int>)->Apply(SequenceSizes);
+
+// Array has a fixed size, so the sizes are template arguments here
+template <typename C>
+static void BM_ArrayFillIterate(benchmark::State& state) {
+  C c;
+  for (auto _ : state) {
+    c.fill(1);
+    benchmark::DoNotOptimize(c.data());
+    benchmark::DoNotOptimize(Sum(c));
+  }
+  state.SetItemsProcessed(state.iterations() * c.size());
+}
+BENCHMARK_TEMPLATE(BM_ArrayFillIterate, s21::Array<int, 256>);
+BENCHMARK_TEMPLATE(BM_ArrayFillIterate, std::array<int, 256>);
+BENCHMARK_TEMPLATE(BM_ArrayFillIterate, s21::Array<int, 65536>);
+BENCHMARK_TEMPLATE(BM_ArrayFillIterate, std::array<int, 65536>);
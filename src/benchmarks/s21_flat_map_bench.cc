@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "../s21_flat_map.h"
+#include "../s21_flat_set.h"
+#include "../s21_map.h"
+#include "../s21_set.h"
+
+// Sorted-vector containers against the red-black tree ones: random lookups,
+// half of them misses, and the memory each element costs once loaded.
+
+static std::vector<int> ShuffledKeys(int n) {
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i * 2;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+  return keys;
+}
+
+static std::vector<std::pair<int, int>> ShuffledPairs(int n) {
+  std::vector<std::pair<int, int>> pairs;
+  for (int key : ShuffledKeys(n)) pairs.push_back({key, key});
+  return pairs;
+}
+
+// the flat containers load with one sort; n shifting inserts would be
+// quadratic
+template <typename SetType>
+static SetType Load(const std::vector<int>& keys) {
+  if constexpr (std::is_same_v<SetType, s21::FlatSet<int>>) {
+    return SetType::from_unsorted(keys.begin(), keys.end());
+  } else {
+    SetType s;
+    for (int key : keys) s.insert(key);
+    return s;
+  }
+}
+
+template <typename MapType>
+static MapType Load(const std::vector<std::pair<int, int>>& pairs) {
+  if constexpr (std::is_same_v<MapType, s21::FlatMap<int, int>>) {
+    return MapType::from_unsorted(pairs.begin(), pairs.end());
+  } else {
+    MapType m;
+    for (auto const& item : pairs) m.insert(item);
+    return m;
+  }
+}
+
+template <typename SetType>
+static void BM_SetLookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const SetType s = Load<SetType>(ShuffledKeys(n));
+  std::mt19937 gen(7);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.contains(static_cast<int>(gen() % n) * 2 +
+                                        static_cast<int>(gen() & 1)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_SetLookup, s21::FlatSet<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SetLookup, s21::Set<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20);
+
+template <typename MapType>
+static void BM_MapLookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const MapType m = Load<MapType>(ShuffledPairs(n));
+  std::mt19937 gen(7);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.find(static_cast<int>(gen() % n) * 2 +
+                                    static_cast<int>(gen() & 1)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MapLookup, s21::FlatMap<int, int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_MapLookup, s21::Map<int, int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20);
+
+// Loading n shuffled pairs: one sort for the flat map, n inserts for the tree.
+// bytes_per_element counts the vector's capacity or one node per element,
+// before any allocator overhead.
+static void BM_FlatMapLoad(benchmark::State& state) {
+  std::vector<std::pair<int, int>> pairs =
+      ShuffledPairs(static_cast<int>(state.range(0)));
+  double bytes = 0;
+  for (auto _ : state) {
+    auto m = s21::FlatMap<int, int>::from_unsorted(pairs.begin(), pairs.end());
+    bytes = static_cast<double>(m.capacity()) *
+            sizeof(s21::FlatMap<int, int>::value_type) / m.size();
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.counters["bytes_per_element"] = bytes;
+  state.SetItemsProcessed(state.iterations() * pairs.size());
+}
+BENCHMARK(BM_FlatMapLoad)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+static void BM_TreeMapLoad(benchmark::State& state) {
+  std::vector<std::pair<int, int>> pairs =
+      ShuffledPairs(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::Map<int, int> m;
+    for (auto const& item : pairs) m.insert(item);
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.counters["bytes_per_element"] = sizeof(s21::Map<int, int>::Node);
+  state.SetItemsProcessed(state.iterations() * pairs.size());
+}
+BENCHMARK(BM_TreeMapLoad)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatSetLoad(benchmark::State& state) {
+  std::vector<int> keys = ShuffledKeys(static_cast<int>(state.range(0)));
+  double bytes = 0;
+  for (auto _ : state) {
+    auto s = s21::FlatSet<int>::from_unsorted(keys.begin(), keys.end());
+    bytes = static_cast<double>(s.capacity()) * sizeof(int) / s.size();
+    benchmark::DoNotOptimize(s.begin());
+  }
+  state.counters["bytes_per_element"] = bytes;
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_FlatSetLoad)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+static void BM_TreeSetLoad(benchmark::State& state) {
+  std::vector<int> keys = ShuffledKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::Set<int> s;
+    for (int key : keys) s.insert(key);
+    benchmark::DoNotOptimize(s.begin());
+  }
+  state.counters["bytes_per_element"] = sizeof(s21::Set<int>::Node);
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_TreeSetLoad)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "../s21_list.h"
+#include "../s21_pool.h"
+
+// Queue-style traffic: keep a window of live nodes and push to the back while
+// popping from the front, once with a heap allocation per node and once with
+// nodes recycled through a per-list slab pool.
+
+template <typename ListType>
+static void BM_ListPushPop(benchmark::State& state) {
+  const int window = static_cast<int>(state.range(0));
+  ListType list;
+  for (int i = 0; i < window; ++i) list.push_back(i);
+  int value = 0;
+  for (auto _ : state) {
+    list.push_back(value++);
+    list.pop_front();
+  }
+  benchmark::DoNotOptimize(list.size());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_ListPushPop, s21::List<int>)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ListPushPop, s21::List<int, s21::PoolAllocator<int>>)
+    ->Range(16, 1 << 16);
+
+template <typename ListType>
+static void BM_ListFillDrain(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  ListType list;
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) list.push_back(i);
+    while (!list.empty()) list.pop_front();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_ListFillDrain, s21::List<int>)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(BM_ListFillDrain, s21::List<int, s21::PoolAllocator<int>>)
+    ->Range(16, 1 << 16);
+
+// Sort relinks nodes, so its cost should not depend on the payload size.
+struct HeavyRecord {
+  HeavyRecord(int k = 0) : key(k) {}
+  int key;
+  char payload[256] = {};
+  bool operator<(const HeavyRecord& other) const { return key < other.key; }
+};
+
+template <typename T>
+static void BM_ListSortRandom(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::mt19937 gen(21);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::List<T> list;
+    for (int i = 0; i < n; ++i) {
+      list.push_back(T(static_cast<int>(gen())));
+    }
+    state.ResumeTiming();
+    list.Sort();
+    benchmark::DoNotOptimize(list.front());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK_TEMPLATE(BM_ListSortRandom, int)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oNLogN);
+BENCHMARK_TEMPLATE(BM_ListSortRandom, HeavyRecord)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 100000)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oNLogN);
+
+// Merging a sorted shard into a sorted list only relinks nodes.
+static void BM_ListMergeSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::List<int> list;
+    s21::List<int> shard;
+    for (int i = 0; i < n; ++i) {
+      list.push_back(2 * i);
+      shard.push_back(2 * i + 1);
+    }
+    state.ResumeTiming();
+    list.Merge(shard);
+    benchmark::DoNotOptimize(list.back());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_ListMergeSorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Unit(benchmark::kMicrosecond)
+    ->Complexity(benchmark::oN);
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "../s21_parallel.h"
+#include "../s21_vector.h"
+
+// Speedup curves of s21::parallel over s21::Vector: the argument is the
+// number of cores used, the workers plus the calling thread, from 1 to
+// every core, and the std runs on one thread are the baseline. The sorts
+// restore the shuffled input outside the timing before every iteration.
+
+static const int kCores =
+    static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+// 16M keys, 128 MB; the sorts keep a second copy to restore from
+static constexpr size_t kCount = size_t{1} << 24;
+
+static s21::Vector<uint64_t>& Shuffled() {
+  static s21::Vector<uint64_t> values = [] {
+    s21::Vector<uint64_t> v(kCount);
+    std::mt19937_64 random(42);
+    for (size_t i = 0; i < kCount; ++i) v[i] = random();
+    return v;
+  }();
+  return values;
+}
+
+template <class Sort>
+static void RunSort(benchmark::State& state, Sort sort) {
+  s21::Vector<uint64_t>& shuffled = Shuffled();
+  s21::Vector<uint64_t> v(kCount);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::copy(shuffled.data(), shuffled.data() + kCount, v.data());
+    state.ResumeTiming();
+    sort(v.begin(), v.end());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+static void BM_StdSort(benchmark::State& state) {
+  RunSort(state, [](auto first, auto last) { std::sort(first, last); });
+}
+BENCHMARK(BM_StdSort)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelSort(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0) - 1);
+  RunSort(state, [&pool](auto first, auto last) {
+    s21::parallel::sort(pool, first, last);
+  });
+}
+BENCHMARK(BM_ParallelSort)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_StdStableSort(benchmark::State& state) {
+  RunSort(state,
+          [](auto first, auto last) { std::stable_sort(first, last); });
+}
+BENCHMARK(BM_StdStableSort)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelStableSort(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0) - 1);
+  RunSort(state, [&pool](auto first, auto last) {
+    s21::parallel::stable_sort(pool, first, last);
+  });
+}
+BENCHMARK(BM_ParallelStableSort)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_StdReduce(benchmark::State& state) {
+  s21::Vector<uint64_t>& v = Shuffled();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::accumulate(v.data(), v.data() + kCount, uint64_t{0}));
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(uint64_t));
+}
+BENCHMARK(BM_StdReduce)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelReduce(benchmark::State& state) {
+  s21::Vector<uint64_t>& v = Shuffled();
+  s21::ThreadPool pool(state.range(0) - 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::parallel::reduce(
+        pool, v.data(), v.data() + kCount, uint64_t{0}));
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(uint64_t));
+}
+BENCHMARK(BM_ParallelReduce)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_StdInclusiveScan(benchmark::State& state) {
+  s21::Vector<uint64_t>& v = Shuffled();
+  s21::Vector<uint64_t> sums(kCount);
+  for (auto _ : state) {
+    std::partial_sum(v.data(), v.data() + kCount, sums.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(uint64_t));
+}
+BENCHMARK(BM_StdInclusiveScan)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelInclusiveScan(benchmark::State& state) {
+  s21::Vector<uint64_t>& v = Shuffled();
+  s21::Vector<uint64_t> sums(kCount);
+  s21::ThreadPool pool(state.range(0) - 1);
+  for (auto _ : state) {
+    s21::parallel::inclusive_scan(pool, v.data(), v.data() + kCount,
+                                  sums.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * kCount * sizeof(uint64_t));
+}
+BENCHMARK(BM_ParallelInclusiveScan)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
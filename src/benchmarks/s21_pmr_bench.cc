@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <random>
+#include <string>
+
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_vector.h"
+
+// A request handler that builds a few short-lived containers and throws them
+// away. The pmr runs carve everything out of one monotonic buffer and release
+// it in one step per request; the heap runs go through operator new for every
+// node and every vector growth, and free them one at a time.
+
+static std::vector<int> RequestKeys(int n) {
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+  return keys;
+}
+
+template <typename MapType, typename VectorType, typename ListType,
+          typename... Alloc>
+static long long HandleRequest(const std::vector<int>& keys,
+                               const Alloc&... alloc) {
+  MapType index(alloc...);
+  VectorType row(alloc...);
+  ListType pending(alloc...);
+  for (int key : keys) {
+    index[key] = key;
+    row.push_back(key);
+    if (key & 1) pending.push_back(key);
+  }
+  long long sum = 0;
+  for (int key : keys) sum += index[key];
+  return sum + static_cast<long long>(row.size() + pending.size());
+}
+
+static void BM_RequestHeap(benchmark::State& state) {
+  const std::vector<int> keys = RequestKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        HandleRequest<s21::Map<int, int>, s21::Vector<int>, s21::List<int>>(
+            keys));
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_RequestHeap)->Range(64, 1 << 16);
+
+static void BM_RequestMonotonic(benchmark::State& state) {
+  const std::vector<int> keys = RequestKeys(static_cast<int>(state.range(0)));
+  // sized for the largest request so no run falls back to the upstream heap
+  std::vector<char> buffer(keys.size() * 160 + 4096);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+  for (auto _ : state) {
+    std::pmr::polymorphic_allocator<int> alloc(&arena);
+    benchmark::DoNotOptimize(
+        HandleRequest<s21::pmr::Map<int, int>, s21::pmr::Vector<int>,
+                      s21::pmr::List<int>>(keys, alloc));
+    arena.release();
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_RequestMonotonic)->Range(64, 1 << 16);
+
+// a fresh pool per request, for handlers that also erase and reuse memory
+static void BM_RequestPool(benchmark::State& state) {
+  const std::vector<int> keys = RequestKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<int> alloc(&pool);
+    benchmark::DoNotOptimize(
+        HandleRequest<s21::pmr::Map<int, int>, s21::pmr::Vector<int>,
+                      s21::pmr::List<int>>(keys, alloc));
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_RequestPool)->Range(64, 1 << 16);
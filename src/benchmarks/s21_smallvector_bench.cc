@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include "../s21_smallvector.h"
+#include "../s21_vector.h"
+
+// Both containers allocate exactly when their capacity changes, so one
+// untimed fill is enough to count the allocations behind each iteration.
+template <typename VectorType>
+static int AllocationsToFill(int n) {
+  VectorType v;
+  int allocations = 0;
+  for (int i = 0; i < n; ++i) {
+    size_t capacity = v.capacity();
+    v.push_back(i);
+    if (v.capacity() != capacity) ++allocations;
+  }
+  return allocations;
+}
+
+// A short-lived vector of a few elements, like the per-request vectors that
+// rarely grow past a handful of entries.
+template <typename VectorType>
+static void BM_ShortLivedVector(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType v;
+    for (int i = 0; i < n; ++i) v.push_back(i);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["allocs"] = AllocationsToFill<VectorType>(n);
+}
+BENCHMARK_TEMPLATE(BM_ShortLivedVector, s21::Vector<int>)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_ShortLivedVector, s21::SmallVector<int, 8>)
+    ->DenseRange(2, 16, 2);
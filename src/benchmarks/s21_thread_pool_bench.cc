@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include "../s21_thread_pool.h"
+#include "../s21_vector.h"
+
+// Scaling of the fork/join pool: the argument is the number of cores used,
+// the workers plus the calling thread, from 1 to every core. Both splits
+// stop forking below a grain so the tasks stay much larger than a push and
+// a steal; the serial runs give the speedup baseline.
+
+static const int kCores =
+    static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+static long SerialFib(int n) {
+  return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2);
+}
+
+static long ParallelFib(s21::ThreadPool& pool, int n) {
+  if (n < 20) return SerialFib(n);
+  long a = 0, b = 0;
+  pool.parallel_invoke([&] { a = ParallelFib(pool, n - 1); },
+                       [&] { b = ParallelFib(pool, n - 2); });
+  return a + b;
+}
+
+static void BM_FibSerial(benchmark::State& state) {
+  for (auto _ : state) benchmark::DoNotOptimize(SerialFib(32));
+}
+BENCHMARK(BM_FibSerial)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_FibParallel(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0) - 1);
+  for (auto _ : state) benchmark::DoNotOptimize(ParallelFib(pool, 32));
+}
+BENCHMARK(BM_FibParallel)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 100M doubles, 800 MB, built once and shared by the sum runs
+static s21::Vector<double>& Values() {
+  static s21::Vector<double> values = [] {
+    s21::Vector<double> v(100'000'000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<double>(i % 1000);
+    return v;
+  }();
+  return values;
+}
+
+static double SerialSum(const double* first, const double* last) {
+  double sum = 0;
+  for (; first != last; ++first) sum += *first;
+  return sum;
+}
+
+static double ParallelSum(s21::ThreadPool& pool, const double* first,
+                          const double* last) {
+  if (last - first <= (1 << 16)) return SerialSum(first, last);
+  const double* middle = first + (last - first) / 2;
+  double left = 0, right = 0;
+  pool.parallel_invoke([&] { left = ParallelSum(pool, first, middle); },
+                       [&] { right = ParallelSum(pool, middle, last); });
+  return left + right;
+}
+
+static void BM_SumSerial(benchmark::State& state) {
+  s21::Vector<double>& v = Values();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SerialSum(v.data(), v.data() + v.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(double));
+}
+BENCHMARK(BM_SumSerial)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_SumParallel(benchmark::State& state) {
+  s21::Vector<double>& v = Values();
+  s21::ThreadPool pool(state.range(0) - 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        ParallelSum(pool, v.data(), v.data() + v.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(double));
+}
+BENCHMARK(BM_SumParallel)
+    ->DenseRange(1, kCores)
+    ->ArgName("cores")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,308 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "../s21_map.h"
+#include "../s21_multiset.h"
+#include "../s21_set.h"
+
+// Sorted keys used to degrade the old unbalanced trees to a linked list;
+// with the red-black core every run should report an N log N fit.
+
+static void BM_SetInsertSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Set<int> set;
+    for (int i = 0; i < n; ++i) set.insert(i);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_SetInsertSorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oNLogN);
+
+static void BM_SetInsertRandom(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::mt19937 gen(21);
+  std::vector<int> keys(n);
+  for (auto& key : keys) key = static_cast<int>(gen());
+  for (auto _ : state) {
+    s21::Set<int> set;
+    for (int key : keys) set.insert(key);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_SetInsertRandom)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oNLogN);
+
+static void BM_SetFindSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Set<int> set;
+  for (int i = 0; i < n; ++i) set.insert(i);
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) benchmark::DoNotOptimize(set.contains(i));
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_SetFindSorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oNLogN);
+
+static void BM_MapInsertSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Map<int, int> map;
+    for (int i = 0; i < n; ++i) map.insert(i, i);
+    benchmark::DoNotOptimize(map.Size());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_MapInsertSorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oNLogN);
+
+static void BM_MultisetInsertSorted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Multiset<int> set;
+    for (int i = 0; i < n; ++i) set.insert(i / 2);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_MultisetInsertSorted)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oNLogN);
+
+// Order statistics. Build once as is and once with
+//   make bench BENCH_DEFS=-DS21_TREE_SUBTREE_SIZE=0
+// to see what keeping subtree sizes costs the inserts above and what it buys
+// here; the label tells the two runs apart.
+
+static const char* SubtreeSizeLabel() {
+  return S21_TREE_SUBTREE_SIZE ? "subtree_size=on" : "subtree_size=off";
+}
+
+static void BM_SetNth(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Set<int> set;
+  for (int i = 0; i < n; ++i) set.insert(i);
+  std::mt19937 gen(21);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(*set.nth(gen() % n));
+  }
+  state.SetComplexityN(n);
+  state.SetLabel(SubtreeSizeLabel());
+}
+BENCHMARK(BM_SetNth)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 18)
+    ->Complexity();
+
+static void BM_MultisetRank(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Multiset<int> set;
+  for (int i = 0; i < n; ++i) set.insert(i / 4);
+  std::mt19937 gen(21);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.rank(static_cast<int>(gen() % (n / 4))));
+  }
+  state.SetComplexityN(n);
+  state.SetLabel(SubtreeSizeLabel());
+}
+BENCHMARK(BM_MultisetRank)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 18)
+    ->Complexity();
+
+static void BM_SetEraseRandom(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Set<int> set;
+    for (int i = 0; i < n; ++i) set.insert(i);
+    state.ResumeTiming();
+    for (int key : keys) set.erase(set.find(key));
+  }
+  state.SetComplexityN(n);
+  state.SetLabel(SubtreeSizeLabel());
+}
+BENCHMARK(BM_SetEraseRandom)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 18)
+    ->Complexity(benchmark::oNLogN);
+
+// Time-window scan over a timestamp index: find where the window starts and
+// walk a fixed number of entries. The start used to be a linear walk from
+// begin(), so the fit should now be logarithmic.
+static void BM_MultisetWindowScan(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Multiset<int> index;
+  for (int i = 0; i < n; ++i) index.insert(i / 2);
+  std::mt19937 gen(21);
+  for (auto _ : state) {
+    int from = static_cast<int>(gen() % (n / 2));
+    long long sum = 0;
+    int taken = 0;
+    for (auto it = index.lower_bound(from); it != index.end() && taken < 16;
+         ++it, ++taken) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetComplexityN(n);
+}
+BENCHMARK(BM_MultisetWindowScan)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 20)
+    ->Complexity(benchmark::oLogN);
+
+// Loading a sorted snapshot: one insert per element from the root, inserts
+// hinted with end(), and the O(n) build.
+static std::vector<std::pair<int, int>> SortedSnapshot(int n) {
+  std::vector<std::pair<int, int>> items(n);
+  for (int i = 0; i < n; ++i) items[i] = {i, i};
+  return items;
+}
+
+static void BM_MapLoadInsert(benchmark::State& state) {
+  const auto items = SortedSnapshot(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::Map<int, int> map;
+    for (const auto& item : items) map.insert(item);
+    benchmark::DoNotOptimize(map.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MapLoadInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+static void BM_MapLoadHinted(benchmark::State& state) {
+  const auto items = SortedSnapshot(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::Map<int, int> map;
+    for (const auto& item : items) map.insert(map.end(), item);
+    benchmark::DoNotOptimize(map.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MapLoadHinted)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+static void BM_MapLoadFromSorted(benchmark::State& state) {
+  const auto items = SortedSnapshot(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto map = s21::Map<int, int>::from_sorted(items.begin(), items.end());
+    benchmark::DoNotOptimize(map.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MapLoadFromSorted)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+// Re-partitioning: fold one shard into another. merge relinks nodes, so the
+// only work left is one descent per moved element.
+static void BM_MapMergeShards(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Map<int, int> shard;
+    s21::Map<int, int> other;
+    for (int i = 0; i < n; ++i) (i % 2 ? shard : other).insert({i, i});
+    state.ResumeTiming();
+    shard.merge(other);
+    benchmark::DoNotOptimize(shard.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * n / 2);
+}
+BENCHMARK(BM_MapMergeShards)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+
+// String keys sharing a long prefix, so every comparison walks most of the
+// string. The string_view runs look up through std::less<> and never build a
+// std::string for the probe; the plain runs have to.
+static std::vector<std::string> PrefixedKeys(int n) {
+  std::vector<std::string> keys(n);
+  for (int i = 0; i < n; ++i) {
+    keys[i] = std::string(48, 'k') + std::to_string(i);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+  return keys;
+}
+
+template <typename Compare>
+static void BM_StringSetLookup(benchmark::State& state) {
+  const auto keys = PrefixedKeys(static_cast<int>(state.range(0)));
+  s21::Set<std::string, Compare> set;
+  for (const auto& key : keys) set.insert(key);
+  std::vector<std::string_view> probes(keys.begin(), keys.end());
+  for (auto _ : state) {
+    for (std::string_view probe : probes) {
+      if constexpr (s21::is_transparent<Compare, std::string_view>::value) {
+        benchmark::DoNotOptimize(set.contains(probe));
+      } else {
+        benchmark::DoNotOptimize(set.contains(std::string(probe)));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+BENCHMARK_TEMPLATE(BM_StringSetLookup, std::less<std::string>)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_StringSetLookup, std::less<>)->Range(1 << 10, 1 << 18);
+
+// "Latest N events": the newest entries sit at the back of a map keyed by
+// time. With the header caching both ends, rbegin() is a single load and
+// each step back is amortised O(1).
+static void BM_MapLatestEntries(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Map<int, int> events;
+  for (int t = 0; t < n; ++t) events.insert(events.end(), {t, t});
+  for (auto _ : state) {
+    long long sum = 0;
+    int taken = 0;
+    for (auto it = events.rbegin(); taken < 16; ++it, ++taken) {
+      sum += it->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+BENCHMARK(BM_MapLatestEntries)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_SetBeginAndBack(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Set<int> set;
+  for (int i = 0; i < n; ++i) set.insert(i);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(*set.begin());
+    benchmark::DoNotOptimize(*set.rbegin());
+  }
+}
+BENCHMARK(BM_SetBeginAndBack)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+// Shape diagnostics: the full walk grows with n, the 64-sample estimate
+// with log n, so only the latter belongs on a metrics path.
+static void BM_MapDebugStats(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Map<int, int> m;
+  for (int i = 0; i < n; ++i) m.insert(m.end(), {i, i});
+  for (auto _ : state) benchmark::DoNotOptimize(m.debug_stats().height);
+}
+BENCHMARK(BM_MapDebugStats)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_MapSampledDepth(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Map<int, int> m;
+  for (int i = 0; i < n; ++i) m.insert(m.end(), {i, i});
+  for (auto _ : state) benchmark::DoNotOptimize(m.sampled_depth());
+}
+BENCHMARK(BM_MapSampledDepth)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <unordered_map>
+
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+
+// ID -> record lookups: the same shuffled ids are inserted into each map and
+// then looked up, half of the probes hitting and half missing.
+
+static std::vector<int> ShuffledIds(int n) {
+  std::vector<int> ids(n);
+  for (int i = 0; i < n; ++i) ids[i] = i * 2;
+  std::shuffle(ids.begin(), ids.end(), std::mt19937(21));
+  return ids;
+}
+
+// std::unordered_map has no contains() before C++20
+template <typename MapType, typename Key>
+static bool Contains(const MapType& m, const Key& key) {
+  return m.contains(key);
+}
+template <typename Key, typename T>
+static bool Contains(const std::unordered_map<Key, T>& m, const Key& key) {
+  return m.find(key) != m.end();
+}
+
+template <typename MapType>
+static void BM_HashInsert(benchmark::State& state) {
+  const std::vector<int> ids = ShuffledIds(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    MapType m;
+    for (int id : ids) m.insert({id, id});
+    benchmark::DoNotOptimize(m.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK_TEMPLATE(BM_HashInsert, s21::UnorderedMap<int, int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HashInsert, std::unordered_map<int, int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HashInsert, s21::Map<int, int>)->Range(1 << 10, 1 << 20);
+
+template <typename MapType>
+static void BM_HashLookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<int> ids = ShuffledIds(n);
+  MapType m;
+  for (int id : ids) m.insert({id, id});
+  // odd ids were never inserted
+  std::vector<int> probes(ids);
+  for (int i = 0; i < n; i += 2) probes[i] += 1;
+  for (auto _ : state) {
+    int found = 0;
+    for (int id : probes) found += Contains(m, id);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+BENCHMARK_TEMPLATE(BM_HashLookup, s21::UnorderedMap<int, int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HashLookup, std::unordered_map<int, int>)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HashLookup, s21::Map<int, int>)->Range(1 << 10, 1 << 20);
+
+template <typename MapType>
+static void BM_HashStringLookup(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  std::vector<std::string> keys;
+  MapType m;
+  for (int id : ShuffledIds(n)) {
+    keys.push_back("record-" + std::to_string(id));
+    m.insert({keys.back(), id});
+  }
+  for (auto _ : state) {
+    int found = 0;
+    for (const auto& key : keys) found += Contains(m, key);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashStringLookup, s21::UnorderedMap<std::string, int>)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_HashStringLookup, std::unordered_map<std::string, int>)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_HashStringLookup, s21::Map<std::string, int>)
+    ->Range(1 << 10, 1 << 18);
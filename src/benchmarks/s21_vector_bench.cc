@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "../s21_vector.h"
+
+// Growth by push_back from an empty vector. Strings are long enough to live on
+// the heap, so copying them on every reallocation would show up clearly.
+static void BM_VectorGrowString(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  const std::string value(64, 'x');
+  for (auto _ : state) {
+    s21::Vector<std::string> v;
+    for (int i = 0; i < n; ++i) v.push_back(value);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_VectorGrowString)->Range(64, 1 << 16);
+
+static void BM_VectorEmplaceString(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Vector<std::string> v;
+    for (int i = 0; i < n; ++i) v.emplace_back(64, 'x');
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_VectorEmplaceString)->Range(64, 1 << 16);
+
+// Counts how the elements were relocated while the vector grew.
+struct Counted {
+  static int64_t copies;
+  static int64_t moves;
+  int value;
+  Counted(int v = 0) : value(v) {}
+  Counted(const Counted& other) : value(other.value) { ++copies; }
+  Counted(Counted&& other) noexcept : value(other.value) { ++moves; }
+  Counted& operator=(const Counted& other) = default;
+  Counted& operator=(Counted&& other) noexcept = default;
+};
+int64_t Counted::copies = 0;
+int64_t Counted::moves = 0;
+
+static void BM_VectorGrowCounted(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  Counted::copies = Counted::moves = 0;
+  for (auto _ : state) {
+    s21::Vector<Counted> v;
+    for (int i = 0; i < n; ++i) v.emplace_back(i);
+    benchmark::DoNotOptimize(v.data());
+  }
+  const double iterations = static_cast<double>(state.iterations());
+  state.counters["copies"] = Counted::copies / iterations;
+  state.counters["moves"] = Counted::moves / iterations;
+}
+BENCHMARK(BM_VectorGrowCounted)->Range(64, 1 << 16);
+
+// Batch insertion into the middle of a large buffer: one range insert against
+// the same batch inserted one element at a time.
+static void BM_VectorInsertRangeMiddle(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Vector<int> batch(1024);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Vector<int> v(n);
+    state.ResumeTiming();
+    v.insert(v.begin() + n / 2, batch.begin(), batch.end());
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_VectorInsertRangeMiddle)->Range(1 << 10, 1 << 18);
+
+static void BM_VectorInsertLoopMiddle(benchmark::State& state) {
+  const int n = static_cast<int>(state.range(0));
+  s21::Vector<int> batch(1024);
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Vector<int> v(n);
+    state.ResumeTiming();
+    auto pos = v.begin() + n / 2;
+    for (auto it = batch.begin(); it != batch.end(); ++it) {
+      pos = v.insert(pos, *it) + 1;
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_VectorInsertLoopMiddle)->Range(1 << 10, 1 << 18);
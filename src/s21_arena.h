@@ -0,0 +1,168 @@
+#ifndef SRC_S21_ARENA_H_
+#define SRC_S21_ARENA_H_
+
+#include "s21_helpsrc.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace s21 {
+// Monotonic bump allocator. Memory is carved out of large chunks by moving a
+// cursor forward; deallocate does nothing and everything comes back at once
+// with release() or the destructor, so tearing down the containers that live
+// in an arena costs one free per chunk however many nodes they hold.
+//
+// With huge_pages set, chunks are rounded up to 2 MiB and mapped with mmap
+// and madvise(MADV_HUGEPAGE), which cuts TLB misses when walking large node
+// based containers. Elsewhere than Linux the flag is ignored.
+//
+// An arena is not thread safe and must outlive every allocator that uses it.
+class Arena {
+ public:
+  static constexpr size_t kDefaultChunkSize = size_t{1} << 20;
+  static constexpr size_t kHugePageSize = size_t{2} << 20;
+
+  explicit Arena(size_t chunk_size = kDefaultChunkSize,
+                 bool huge_pages = false)
+      : chunk_size_(chunk_size ? chunk_size : kDefaultChunkSize),
+        huge_pages_(huge_pages) {}
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  ~Arena() { release(); }
+
+  void* allocate(size_t bytes, size_t align = alignof(std::max_align_t)) {
+    // chunk_end_ need not be aligned, so the padding alone may not fit
+    size_t left = static_cast<size_t>(chunk_end_ - cursor_);
+    size_t padding = padding_for(cursor_, align);
+    if (!cursor_ || padding > left || bytes > left - padding) {
+      add_chunk(bytes + align);
+      padding = padding_for(cursor_, align);
+    }
+    char* start = cursor_ + padding;
+    cursor_ = start + bytes;
+    used_ += bytes;
+    return start;
+  }
+  void deallocate(void*, size_t) noexcept {}  // see release()
+
+  // frees every chunk; everything allocated from the arena becomes invalid
+  void release() noexcept {
+    while (chunks_) {
+      Chunk* prev = chunks_->prev;
+      free_chunk(chunks_);
+      chunks_ = prev;
+    }
+    cursor_ = chunk_end_ = nullptr;
+    chunk_count_ = used_ = reserved_ = 0;
+  }
+
+  size_t bytes_used() const { return used_; }  // requested, without padding
+  size_t bytes_reserved() const { return reserved_; }
+  size_t chunk_count() const { return chunk_count_; }
+  bool huge_pages() const { return huge_pages_; }
+
+ private:
+  struct alignas(std::max_align_t) Chunk {
+    Chunk* prev;
+    size_t size;  // bytes including this header
+    bool mapped;
+  };
+
+  size_t chunk_size_;
+  bool huge_pages_;
+  Chunk* chunks_ = nullptr;
+  char* cursor_ = nullptr;
+  char* chunk_end_ = nullptr;
+  size_t chunk_count_ = 0;
+  size_t used_ = 0;
+  size_t reserved_ = 0;
+
+  static size_t padding_for(const char* ptr, size_t align) {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    return (align - address % align) % align;
+  }
+
+  // a request larger than the chunk size gets a chunk of its own size; the
+  // rest of the current chunk is given up
+  void add_chunk(size_t min_bytes) {
+    size_t size = sizeof(Chunk) + std::max(chunk_size_, min_bytes);
+    void* memory = nullptr;
+    bool mapped = false;
+#ifdef __linux__
+    if (huge_pages_) {
+      size = (size + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+      memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (memory == MAP_FAILED) throw std::bad_alloc();
+      madvise(memory, size, MADV_HUGEPAGE);  // only a hint, may be refused
+      mapped = true;
+    }
+#endif
+    if (!mapped) memory = ::operator new(size);
+    Chunk* chunk = static_cast<Chunk*>(memory);
+    chunk->prev = chunks_;
+    chunk->size = size;
+    chunk->mapped = mapped;
+    chunks_ = chunk;
+    ++chunk_count_;
+    reserved_ += size;
+    cursor_ = reinterpret_cast<char*>(chunk + 1);
+    chunk_end_ = reinterpret_cast<char*>(chunk) + size;
+  }
+
+  static void free_chunk(Chunk* chunk) noexcept {
+#ifdef __linux__
+    if (chunk->mapped) {
+      munmap(chunk, chunk->size);
+      return;
+    }
+#endif
+    ::operator delete(chunk);
+  }
+};
+
+// Allocator handing out memory of an Arena it refers to, like
+// std::pmr::polymorphic_allocator does with a memory resource: copies and
+// rebound copies share the arena, container copies stay in it, and the
+// arena is never propagated on assignment or swap.
+//
+// It marks itself with is_bulk_release, so a Tree or List of trivially
+// destructible values drops its nodes on clear without visiting them.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using is_bulk_release = std::true_type;
+
+  ArenaAllocator(Arena* arena) noexcept : arena_(arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : arena_(other.arena()) {}
+
+  T* allocate(size_type n) {
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T*, size_type) noexcept {}
+
+  Arena* arena() const { return arena_; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return arena_ != other.arena();
+  }
+
+ private:
+  Arena* arena_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_ARENA_H_
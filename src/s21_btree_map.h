@@ -0,0 +1,898 @@
+#ifndef SRC_S21_BTREE_MAP_H_
+#define SRC_S21_BTREE_MAP_H_
+
+#include "s21_helpsrc.h"
+#include "s21_stats.h"
+#include "s21_vector.h"
+
+namespace s21 {
+namespace btree_internal {
+// Uninitialised room for N objects of type U; the owning node tracks how
+// many of them are alive.
+template <typename U, size_t N>
+struct Slots {
+  alignas(U) unsigned char bytes[N * sizeof(U)];
+  U* data() { return reinterpret_cast<U*>(bytes); }
+  const U* data() const { return reinterpret_cast<const U*>(bytes); }
+  U& operator[](size_t i) { return data()[i]; }
+  const U& operator[](size_t i) const { return data()[i]; }
+};
+
+// Number of the first n keys that are < key (count_less) or <= key
+// (count_not_greater). Arithmetic keys are counted without branches, a loop
+// the compiler can turn into vector compares.
+template <typename Key>
+size_t count_less(const Key* keys, size_t n, const Key& key) {
+  if constexpr (std::is_arithmetic_v<Key>) {
+    size_t result = 0;
+    for (size_t i = 0; i < n; ++i) result += keys[i] < key;
+    stats::on_compare(stats::Kind::kBTreeMap, n);
+    return result;
+  } else {
+    size_t i = 0;
+    while (i < n && keys[i] < key) ++i;
+    stats::on_compare(stats::Kind::kBTreeMap, std::min(i + 1, n));
+    return i;
+  }
+}
+
+template <typename Key>
+size_t count_not_greater(const Key* keys, size_t n, const Key& key) {
+  if constexpr (std::is_arithmetic_v<Key>) {
+    size_t result = 0;
+    for (size_t i = 0; i < n; ++i) result += !(key < keys[i]);
+    stats::on_compare(stats::Kind::kBTreeMap, n);
+    return result;
+  } else {
+    size_t i = 0;
+    while (i < n && !(key < keys[i])) ++i;
+    stats::on_compare(stats::Kind::kBTreeMap, std::min(i + 1, n));
+    return i;
+  }
+}
+
+// Moves n live objects from src to the raw slots at dst, leaving src raw.
+template <typename U>
+void relocate(U* src, size_t n, U* dst) {
+  stats::on_move(stats::Kind::kBTreeMap, n);
+  for (size_t i = 0; i < n; ++i) {
+    new (dst + i) U(std::move(src[i]));
+    src[i].~U();
+  }
+}
+
+// Shifts the live objects [pos, n) one slot right, leaving slot pos raw.
+template <typename U>
+void open_gap(U* slots, size_t n, size_t pos) {
+  stats::on_move(stats::Kind::kBTreeMap, n - pos);
+  for (size_t i = n; i > pos; --i) {
+    new (slots + i) U(std::move(slots[i - 1]));
+    slots[i - 1].~U();
+  }
+}
+
+// Shifts the live objects [pos + 1, n) one slot left over the raw slot pos.
+template <typename U>
+void close_gap(U* slots, size_t n, size_t pos) {
+  if (pos < n) stats::on_move(stats::Kind::kBTreeMap, n - pos - 1);
+  for (size_t i = pos + 1; i < n; ++i) {
+    new (slots + i - 1) U(std::move(slots[i]));
+    slots[i].~U();
+  }
+}
+}  // namespace btree_internal
+
+// Ordered map on a B+ tree. Each node is about NodeBytes large and keeps its
+// keys in one contiguous array, so a lookup costs one cache miss per level
+// of a shallow tree instead of one per level of a binary tree. Elements live
+// in the leaves, which are chained for iteration; inner nodes only hold
+// copies of keys that separate their children.
+//
+// Elements move between nodes when nodes split or merge, so unlike s21::Map
+// every insert and erase invalidates iterators. Dereferencing an iterator
+// gives a pair of references, since keys and values are stored apart.
+template <typename Key, typename T, size_t NodeBytes = 256>
+class BTreeMap {
+  static_assert(NodeBytes >= 64, "nodes need room for their bookkeeping");
+  static_assert(std::is_nothrow_move_constructible_v<Key> &&
+                    std::is_nothrow_move_assignable_v<Key> &&
+                    std::is_nothrow_move_constructible_v<T>,
+                "nodes shift their slots with moves, which must not throw");
+  static constexpr stats::Kind kStats = stats::Kind::kBTreeMap;
+
+  template <bool Const>
+  class BTreeIterator;
+  struct Node;
+  struct Leaf;
+  struct Inner;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using size_type = size_t;
+  using iterator = BTreeIterator<false>;
+  using const_iterator = BTreeIterator<true>;
+
+  BTreeMap();
+  BTreeMap(std::initializer_list<value_type> const &items);
+  BTreeMap(const BTreeMap &m);
+  BTreeMap(BTreeMap &&m) noexcept;
+  ~BTreeMap();
+  BTreeMap &operator=(const BTreeMap &m);
+  BTreeMap &operator=(BTreeMap &&m) noexcept;
+
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  mapped_type const *find(key_type const &key) const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(key_type const &key, mapped_type const &obj);
+  std::pair<iterator, bool> insert_or_assign(key_type const &key,
+                                             mapped_type const &obj);
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+  void swap(BTreeMap &other) noexcept;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+  void merge(BTreeMap &other);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  template <typename... Args>
+  s21::Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  static constexpr size_t fit(size_t slots) {
+    return slots < 3 ? 3 : slots > 0xffff ? 0xffff : slots;
+  }
+  // a leaf also carries its two chain pointers, an inner node one child
+  // pointer more than it has keys
+  static constexpr size_t kLeafSlots =
+      fit((NodeBytes - 3 * sizeof(void *)) / (sizeof(Key) + sizeof(T)));
+  static constexpr size_t kInnerSlots =
+      fit((NodeBytes - 2 * sizeof(void *)) / (sizeof(Key) + sizeof(void *)));
+  static constexpr size_t kLeafMin = kLeafSlots / 2;
+  static constexpr size_t kInnerMin = kInnerSlots / 2;
+  // every node below the root has two children or more
+  static constexpr size_t kMaxDepth = 64;
+
+  struct Node {
+    explicit Node(bool is_leaf) : leaf(is_leaf) {}
+    uint16_t count = 0;  // keys held
+    bool leaf;
+  };
+
+  struct Leaf : Node {
+    Leaf() : Node(true) {}
+    Leaf *prev = nullptr;
+    Leaf *next = nullptr;
+    btree_internal::Slots<key_type, kLeafSlots> keys;
+    btree_internal::Slots<mapped_type, kLeafSlots> values;
+  };
+
+  struct Inner : Node {
+    Inner() : Node(false) {}
+    btree_internal::Slots<key_type, kInnerSlots> keys;
+    Node *children[kInnerSlots + 1];
+  };
+
+  // inner nodes passed on the way down and the child taken in each
+  struct Path {
+    Inner *nodes[kMaxDepth];
+    size_t index[kMaxDepth];
+    size_t depth = 0;
+  };
+
+  template <bool Const>
+  class BTreeIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = BTreeMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, BTreeMap::const_reference,
+                                         BTreeMap::reference>;
+    // operator-> has to return something that outlives the call
+    struct pointer {
+      reference ref;
+      const reference *operator->() const { return &ref; }
+    };
+
+    BTreeIterator() = default;
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    BTreeIterator(const BTreeIterator<false> &other)
+        : leaf_(other.leaf_), pos_(other.pos_), tree_(other.tree_) {}
+
+    reference operator*() const {
+      return reference(leaf_->keys[pos_], leaf_->values[pos_]);
+    }
+    pointer operator->() const { return pointer{**this}; }
+    BTreeIterator &operator++() {
+      if (++pos_ == leaf_->count) {
+        leaf_ = leaf_->next;
+        pos_ = 0;
+      }
+      return *this;
+    }
+    BTreeIterator operator++(int) {
+      BTreeIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    BTreeIterator &operator--() {
+      if (!leaf_) {
+        leaf_ = tree_->last_;
+        pos_ = leaf_->count;
+      } else if (pos_ == 0) {
+        leaf_ = leaf_->prev;
+        pos_ = leaf_->count;
+      }
+      --pos_;
+      return *this;
+    }
+    BTreeIterator operator--(int) {
+      BTreeIterator tmp = *this;
+      --*this;
+      return tmp;
+    }
+    bool operator==(const BTreeIterator &other) const {
+      return leaf_ == other.leaf_ && pos_ == other.pos_;
+    }
+    bool operator!=(const BTreeIterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    template <bool>
+    friend class BTreeIterator;
+    friend class BTreeMap;
+
+    Leaf *leaf_ = nullptr;
+    size_t pos_ = 0;
+    const BTreeMap *tree_ = nullptr;
+
+    // a position past the end of a leaf stands for the start of the next
+    BTreeIterator(Leaf *leaf, size_t pos, const BTreeMap *tree)
+        : leaf_(leaf), pos_(pos), tree_(tree) {
+      if (leaf_ && pos_ == leaf_->count) {
+        leaf_ = leaf_->next;
+        pos_ = 0;
+      }
+    }
+  };
+
+  Node *root_ = nullptr;
+  Leaf *first_ = nullptr;
+  Leaf *last_ = nullptr;
+  size_type size_ = 0;
+
+  Leaf *descend(const key_type &key, Path *path) const;
+  iterator find_iterator(const key_type &key) const;
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(const key_type &key,
+                                           Args &&...args);
+  Leaf *make_room(const key_type &key);
+  bool is_full(const Node *node) const;
+  void split_child(Inner *parent, size_t index, const key_type &key);
+  void erase_at(Leaf *leaf, size_t pos, const Path &path);
+  void rebalance_leaf(Leaf *leaf, const Path &path);
+  void rebalance_inner(const Path &path);
+  void remove_child(Inner *parent, size_t key_index);
+  Node *clone(const Node *node, Leaf *&prev);
+  void destroy(Node *node) noexcept;
+  template <typename N>
+  static N *new_node();
+  template <typename N>
+  static void delete_node(N *node) noexcept;
+};
+/*---------------------definitions-------------*/
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap() = default;
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(
+    std::initializer_list<value_type> const &items)
+    : BTreeMap() {
+  for (auto const &item : items) {
+    insert(item);
+  }
+}
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(const BTreeMap &m) {
+  if (m.root_) {
+    Leaf *prev = nullptr;
+    root_ = clone(m.root_, prev);
+    Node *node = root_;
+    while (!node->leaf) node = static_cast<Inner *>(node)->children[0];
+    first_ = static_cast<Leaf *>(node);
+    last_ = prev;
+    size_ = m.size_;
+  }
+}
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(BTreeMap &&m) noexcept {
+  swap(m);
+}
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::~BTreeMap() {
+  destroy(root_);
+}
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes> &BTreeMap<Key, T, NodeBytes>::operator=(
+    const BTreeMap &m) {
+  if (this != &m) {
+    BTreeMap tmp(m);
+    swap(tmp);
+  }
+  return *this;
+}
+template <typename Key, typename T, size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes> &BTreeMap<Key, T, NodeBytes>::operator=(
+    BTreeMap &&m) noexcept {
+  if (this != &m) {
+    clear();
+    swap(m);
+  }
+  return *this;
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::begin() {
+  return iterator(first_, 0, this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::begin() const {
+  return const_iterator(first_, 0, this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::end() {
+  return iterator(nullptr, 0, this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::end() const {
+  return const_iterator(nullptr, 0, this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::empty() const {
+  return size_ == 0;
+}
+template <typename Key, typename T, size_t NodeBytes>
+size_t BTreeMap<Key, T, NodeBytes>::size() const {
+  return size_;
+}
+template <typename Key, typename T, size_t NodeBytes>
+size_t BTreeMap<Key, T, NodeBytes>::max_size() const {
+  return SIZE_MAX / (sizeof(key_type) + sizeof(mapped_type));
+}
+template <typename Key, typename T, size_t NodeBytes>
+const T *BTreeMap<Key, T, NodeBytes>::find(key_type const &key) const {
+  iterator it = find_iterator(key);
+  return it == iterator() ? nullptr : &it.leaf_->values[it.pos_];
+}
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::clear() {
+  destroy(root_);
+  root_ = nullptr;
+  first_ = last_ = nullptr;
+  size_ = 0;
+}
+template <typename Key, typename T, size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert(const value_type &value) {
+  return emplace_unique(value.first, value.second);
+}
+template <typename Key, typename T, size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert(key_type const &key,
+                                    mapped_type const &obj) {
+  return emplace_unique(key, obj);
+}
+template <typename Key, typename T, size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert_or_assign(key_type const &key,
+                                              mapped_type const &obj) {
+  auto result = emplace_unique(key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+template <typename Key, typename T, size_t NodeBytes>
+T &BTreeMap<Key, T, NodeBytes>::at(const key_type &key) {
+  iterator it = find_iterator(key);
+  if (it == end()) throw std::out_of_range("Key not found");
+  return it->second;
+}
+template <typename Key, typename T, size_t NodeBytes>
+const T &BTreeMap<Key, T, NodeBytes>::at(const key_type &key) const {
+  const T *value = find(key);
+  if (!value) throw std::out_of_range("Key not found");
+  return *value;
+}
+template <typename Key, typename T, size_t NodeBytes>
+T &BTreeMap<Key, T, NodeBytes>::operator[](const key_type &key) {
+  return emplace_unique(key).first->second;
+}
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::swap(BTreeMap &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(first_, other.first_);
+  std::swap(last_, other.last_);
+  std::swap(size_, other.size_);
+}
+template <typename Key, typename T, size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::contains(const key_type &key) const {
+  return find_iterator(key) != iterator();
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::lower_bound(const key_type &key) {
+  if (!root_) return end();
+  Leaf *leaf = descend(key, nullptr);
+  return iterator(
+      leaf, btree_internal::count_less(leaf->keys.data(), leaf->count, key),
+      this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::lower_bound(const key_type &key) const {
+  return const_cast<BTreeMap *>(this)->lower_bound(key);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::upper_bound(const key_type &key) {
+  if (!root_) return end();
+  Leaf *leaf = descend(key, nullptr);
+  return iterator(leaf,
+                  btree_internal::count_not_greater(leaf->keys.data(),
+                                                    leaf->count, key),
+                  this);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::upper_bound(const key_type &key) const {
+  return const_cast<BTreeMap *>(this)->upper_bound(key);
+}
+// Elements have to be moved into this tree's own slots one by one; the keys
+// that are already here are collected into a new tree that replaces other.
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::merge(BTreeMap &other) {
+  if (this == &other) return;
+  BTreeMap rest;
+  for (Leaf *leaf = other.first_; leaf; leaf = leaf->next) {
+    for (size_t i = 0; i < leaf->count; ++i) {
+      if (!emplace_unique(leaf->keys[i], std::move(leaf->values[i])).second) {
+        rest.emplace_unique(leaf->keys[i], std::move(leaf->values[i]));
+      }
+    }
+  }
+  other.swap(rest);
+}
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::erase(iterator pos) {
+  if (pos == end()) return;
+  Path path;
+  descend(pos.leaf_->keys[pos.pos_], &path);
+  erase_at(pos.leaf_, pos.pos_, path);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::size_type
+BTreeMap<Key, T, NodeBytes>::erase(const key_type &key) {
+  if (!root_) return 0;
+  Path path;
+  Leaf *leaf = descend(key, &path);
+  size_t pos = btree_internal::count_less(leaf->keys.data(), leaf->count, key);
+  if (pos == leaf->count || key < leaf->keys[pos]) return 0;
+  erase_at(leaf, pos, path);
+  return 1;
+}
+// A split moves elements to a new leaf, so the positions are looked up
+// again once everything is in.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename... Args>
+s21::Vector<std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>>
+BTreeMap<Key, T, NodeBytes>::insert_many(Args &&...args) {
+  s21::Vector<std::pair<iterator, bool>> result;
+  s21::Vector<key_type> keys;
+  auto insert_one = [&](const value_type &value) {
+    result.push_back(insert(value));
+    keys.push_back(value.first);
+  };
+  (insert_one(args), ...);
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i].first = find_iterator(keys[i]);
+  }
+  return result;
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::Leaf *
+BTreeMap<Key, T, NodeBytes>::descend(const key_type &key, Path *path) const {
+  stats::on_lookup(kStats, 0);  // the node searches count the comparisons
+  Node *node = root_;
+  size_t depth = 0;
+  while (!node->leaf) {
+    Inner *inner = static_cast<Inner *>(node);
+    // keys equal to a separator live to its right
+    size_t index = btree_internal::count_not_greater(inner->keys.data(),
+                                                     inner->count, key);
+    if (path) {
+      path->nodes[depth] = inner;
+      path->index[depth] = index;
+    }
+    ++depth;
+    node = inner->children[index];
+  }
+  if (path) path->depth = depth;
+  return static_cast<Leaf *>(node);
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::find_iterator(const key_type &key) const {
+  if (!root_) return iterator();
+  Leaf *leaf = descend(key, nullptr);
+  size_t pos = btree_internal::count_less(leaf->keys.data(), leaf->count, key);
+  if (pos == leaf->count || key < leaf->keys[pos]) return iterator();
+  return iterator(leaf, pos, this);
+}
+// The element is built before anything changes, so key and args stay valid
+// even when they refer to elements of this map, and the insertion itself
+// is made of moves that cannot throw.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename... Args>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::emplace_unique(const key_type &key,
+                                            Args &&...args) {
+  Leaf *leaf = nullptr;
+  size_t pos = 0;
+  if (root_) {
+    leaf = descend(key, nullptr);
+    pos = btree_internal::count_less(leaf->keys.data(), leaf->count, key);
+    if (pos < leaf->count && !(key < leaf->keys[pos])) {
+      return {iterator(leaf, pos, this), false};
+    }
+  }
+  key_type new_key(key);
+  mapped_type new_value(std::forward<Args>(args)...);
+  stats::on_copy(kStats);
+  stats::on_construct<mapped_type, Args...>(kStats);
+  if (!root_) {
+    root_ = first_ = last_ = leaf = new_node<Leaf>();
+  } else if (leaf->count == kLeafSlots) {
+    leaf = make_room(new_key);
+    pos = btree_internal::count_less(leaf->keys.data(), leaf->count, new_key);
+  }
+  btree_internal::open_gap(leaf->keys.data(), leaf->count, pos);
+  btree_internal::open_gap(leaf->values.data(), leaf->count, pos);
+  new (&leaf->keys[pos]) key_type(std::move(new_key));
+  new (&leaf->values[pos]) mapped_type(std::move(new_value));
+  stats::on_move(kStats, 2);
+  ++leaf->count;
+  ++size_;
+  return {iterator(leaf, pos, this), true};
+}
+// Descends again splitting every full node on the way, so the leaf reached
+// has room and a split never travels back up. Each split leaves a valid
+// tree behind, which keeps a throwing allocation or key copy harmless.
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::Leaf *
+BTreeMap<Key, T, NodeBytes>::make_room(const key_type &key) {
+  if (is_full(root_)) {
+    Inner *root = new_node<Inner>();
+    root->children[0] = root_;
+    try {
+      split_child(root, 0, key);
+    } catch (...) {
+      delete_node(root);
+      throw;
+    }
+    root_ = root;
+  }
+  Node *node = root_;
+  while (!node->leaf) {
+    Inner *inner = static_cast<Inner *>(node);
+    size_t index = btree_internal::count_not_greater(inner->keys.data(),
+                                                     inner->count, key);
+    if (is_full(inner->children[index])) {
+      split_child(inner, index, key);
+      if (!(key < inner->keys[index])) ++index;
+    }
+    node = inner->children[index];
+  }
+  return static_cast<Leaf *>(node);
+}
+template <typename Key, typename T, size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::is_full(const Node *node) const {
+  return node->count == (node->leaf ? kLeafSlots : kInnerSlots);
+}
+// Splits the full child at index of parent, which has room for one more
+// key. When key goes past the end of the child, as with ascending inserts,
+// the child keeps nearly all of its slots and nodes fill up almost completely.
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::split_child(Inner *parent, size_t index,
+                                              const key_type &key) {
+  Node *child = parent->children[index];
+  Node *sibling;
+  if (child->leaf) {
+    Leaf *leaf = static_cast<Leaf *>(child);
+    size_t split =
+        leaf->keys[leaf->count - 1] < key ? kLeafSlots - 1 : kLeafSlots / 2;
+    Leaf *right = new_node<Leaf>();
+    btree_internal::open_gap(parent->keys.data(), parent->count, index);
+    try {
+      new (&parent->keys[index]) key_type(leaf->keys[split]);
+      stats::on_copy(kStats);
+    } catch (...) {
+      btree_internal::close_gap(parent->keys.data(), parent->count + 1, index);
+      delete_node(right);
+      throw;
+    }
+    right->count = leaf->count - split;
+    btree_internal::relocate(leaf->keys.data() + split, right->count,
+                             right->keys.data());
+    btree_internal::relocate(leaf->values.data() + split, right->count,
+                             right->values.data());
+    leaf->count = split;
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next) {
+      leaf->next->prev = right;
+    } else {
+      last_ = right;
+    }
+    leaf->next = right;
+    sibling = right;
+  } else {
+    Inner *inner = static_cast<Inner *>(child);
+    size_t middle = !(key < inner->keys[inner->count - 1]) ? kInnerSlots - 2
+                                                           : kInnerSlots / 2;
+    Inner *right = new_node<Inner>();
+    // the middle key moves up instead of being copied
+    btree_internal::open_gap(parent->keys.data(), parent->count, index);
+    btree_internal::relocate(&inner->keys[middle], 1, &parent->keys[index]);
+    right->count = inner->count - middle - 1;
+    btree_internal::relocate(&inner->keys[middle + 1], right->count,
+                             right->keys.data());
+    std::copy(inner->children + middle + 1, inner->children + inner->count + 1,
+              right->children);
+    inner->count = middle;
+    sibling = right;
+  }
+  std::copy_backward(parent->children + index + 1,
+                     parent->children + parent->count + 1,
+                     parent->children + parent->count + 2);
+  parent->children[index + 1] = sibling;
+  ++parent->count;
+}
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::erase_at(Leaf *leaf, size_t pos,
+                                           const Path &path) {
+  leaf->keys[pos].~key_type();
+  leaf->values[pos].~mapped_type();
+  btree_internal::close_gap(leaf->keys.data(), leaf->count, pos);
+  btree_internal::close_gap(leaf->values.data(), leaf->count, pos);
+  --leaf->count;
+  --size_;
+  if (path.depth == 0) {
+    if (leaf->count == 0) clear();
+  } else if (leaf->count < kLeafMin) {
+    rebalance_leaf(leaf, path);
+  }
+}
+// Refills an underfull leaf from a sibling that can spare an element, or
+// else merges it with a sibling and lets the parent rebalance in turn.
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalance_leaf(Leaf *leaf,
+                                                 const Path &path) {
+  Inner *parent = path.nodes[path.depth - 1];
+  size_t index = path.index[path.depth - 1];
+  Leaf *left =
+      index > 0 ? static_cast<Leaf *>(parent->children[index - 1]) : nullptr;
+  Leaf *right = index < parent->count
+                    ? static_cast<Leaf *>(parent->children[index + 1])
+                    : nullptr;
+  if (left && left->count > kLeafMin) {
+    // copy the new separator first, the moves below cannot throw
+    key_type separator(left->keys[left->count - 1]);
+    btree_internal::open_gap(leaf->keys.data(), leaf->count, 0);
+    btree_internal::open_gap(leaf->values.data(), leaf->count, 0);
+    --left->count;
+    btree_internal::relocate(&left->keys[left->count], 1, &leaf->keys[0]);
+    btree_internal::relocate(&left->values[left->count], 1, &leaf->values[0]);
+    ++leaf->count;
+    parent->keys[index - 1] = std::move(separator);
+  } else if (right && right->count > kLeafMin) {
+    key_type separator(right->keys[1]);
+    btree_internal::relocate(&right->keys[0], 1, &leaf->keys[leaf->count]);
+    btree_internal::relocate(&right->values[0], 1, &leaf->values[leaf->count]);
+    ++leaf->count;
+    btree_internal::close_gap(right->keys.data(), right->count, 0);
+    btree_internal::close_gap(right->values.data(), right->count, 0);
+    --right->count;
+    parent->keys[index] = std::move(separator);
+  } else {
+    if (left) {
+      right = leaf;
+      leaf = left;
+      --index;
+    }
+    btree_internal::relocate(right->keys.data(), right->count,
+                             &leaf->keys[leaf->count]);
+    btree_internal::relocate(right->values.data(), right->count,
+                             &leaf->values[leaf->count]);
+    leaf->count += right->count;
+    leaf->next = right->next;
+    if (right->next) {
+      right->next->prev = leaf;
+    } else {
+      last_ = leaf;
+    }
+    delete_node(right);
+    remove_child(parent, index);
+    rebalance_inner(path);
+  }
+}
+// Walks up from the parent of a merged pair of nodes, fixing every inner
+// node that dropped below its minimum.
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalance_inner(const Path &path) {
+  for (size_t level = path.depth - 1;; --level) {
+    Inner *node = path.nodes[level];
+    if (level == 0) {
+      if (node->count == 0) {
+        root_ = node->children[0];
+        delete_node(node);
+      }
+      return;
+    }
+    if (node->count >= kInnerMin) return;
+    Inner *parent = path.nodes[level - 1];
+    size_t index = path.index[level - 1];
+    Inner *left =
+        index > 0 ? static_cast<Inner *>(parent->children[index - 1]) : nullptr;
+    Inner *right = index < parent->count
+                       ? static_cast<Inner *>(parent->children[index + 1])
+                       : nullptr;
+    if (left && left->count > kInnerMin) {
+      // rotate the last child of left over through the parent
+      btree_internal::open_gap(node->keys.data(), node->count, 0);
+      btree_internal::relocate(&parent->keys[index - 1], 1, &node->keys[0]);
+      btree_internal::relocate(&left->keys[left->count - 1], 1,
+                               &parent->keys[index - 1]);
+      std::copy_backward(node->children, node->children + node->count + 1,
+                         node->children + node->count + 2);
+      node->children[0] = left->children[left->count];
+      --left->count;
+      ++node->count;
+      return;
+    }
+    if (right && right->count > kInnerMin) {
+      btree_internal::relocate(&parent->keys[index], 1,
+                               &node->keys[node->count]);
+      btree_internal::relocate(&right->keys[0], 1, &parent->keys[index]);
+      btree_internal::close_gap(right->keys.data(), right->count, 0);
+      node->children[node->count + 1] = right->children[0];
+      std::copy(right->children + 1, right->children + right->count + 1,
+                right->children);
+      --right->count;
+      ++node->count;
+      return;
+    }
+    if (left) {
+      right = node;
+      node = left;
+      --index;
+    }
+    // the separator comes down between the two halves
+    new (&node->keys[node->count]) key_type(std::move(parent->keys[index]));
+    stats::on_move(kStats);
+    btree_internal::relocate(right->keys.data(), right->count,
+                             &node->keys[node->count + 1]);
+    std::copy(right->children, right->children + right->count + 1,
+              node->children + node->count + 1);
+    node->count += right->count + 1;
+    delete_node(right);
+    remove_child(parent, index);
+  }
+}
+// Drops the key at key_index of parent together with the child to its
+// right.
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::remove_child(Inner *parent,
+                                               size_t key_index) {
+  parent->keys[key_index].~key_type();
+  btree_internal::close_gap(parent->keys.data(), parent->count, key_index);
+  std::copy(parent->children + key_index + 2,
+            parent->children + parent->count + 1,
+            parent->children + key_index + 1);
+  --parent->count;
+}
+template <typename Key, typename T, size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::Node *BTreeMap<Key, T, NodeBytes>::clone(
+    const Node *node, Leaf *&prev) {
+  if (node->leaf) {
+    const Leaf *source = static_cast<const Leaf *>(node);
+    Leaf *leaf = new_node<Leaf>();
+    try {
+      for (; leaf->count < source->count; ++leaf->count) {
+        size_t i = leaf->count;
+        new (&leaf->keys[i]) key_type(source->keys[i]);
+        try {
+          new (&leaf->values[i]) mapped_type(source->values[i]);
+        } catch (...) {
+          leaf->keys[i].~key_type();
+          throw;
+        }
+        stats::on_copy(kStats, 2);
+      }
+    } catch (...) {
+      destroy(leaf);
+      throw;
+    }
+    leaf->prev = prev;
+    if (prev) prev->next = leaf;
+    prev = leaf;
+    return leaf;
+  }
+  const Inner *source = static_cast<const Inner *>(node);
+  Inner *inner = new_node<Inner>();
+  inner->children[0] = nullptr;
+  try {
+    inner->children[0] = clone(source->children[0], prev);
+    for (size_t i = 0; i < source->count; ++i) {
+      new (&inner->keys[i]) key_type(source->keys[i]);
+      stats::on_copy(kStats);
+      inner->children[i + 1] = nullptr;
+      ++inner->count;
+      inner->children[i + 1] = clone(source->children[i + 1], prev);
+    }
+  } catch (...) {
+    destroy(inner);
+    throw;
+  }
+  return inner;
+}
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::destroy(Node *node) noexcept {
+  if (!node) return;
+  if (node->leaf) {
+    Leaf *leaf = static_cast<Leaf *>(node);
+    for (size_t i = 0; i < leaf->count; ++i) {
+      leaf->keys[i].~key_type();
+      leaf->values[i].~mapped_type();
+    }
+    delete_node(leaf);
+  } else {
+    Inner *inner = static_cast<Inner *>(node);
+    for (size_t i = 0; i <= inner->count; ++i) destroy(inner->children[i]);
+    for (size_t i = 0; i < inner->count; ++i) inner->keys[i].~key_type();
+    delete_node(inner);
+  }
+}
+template <typename Key, typename T, size_t NodeBytes>
+template <typename N>
+N *BTreeMap<Key, T, NodeBytes>::new_node() {
+  N *node = new N();
+  stats::on_allocate(kStats, sizeof(N));
+  return node;
+}
+template <typename Key, typename T, size_t NodeBytes>
+template <typename N>
+void BTreeMap<Key, T, NodeBytes>::delete_node(N *node) noexcept {
+  delete node;
+  stats::on_free(kStats, sizeof(N));
+}
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_MAP_H_
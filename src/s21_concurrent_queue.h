@@ -0,0 +1,167 @@
+#ifndef SRC_S21_CONCURRENT_QUEUE_H_
+#define SRC_S21_CONCURRENT_QUEUE_H_
+
+#include <atomic>
+
+#include "s21_helpsrc.h"
+#include "s21_stats.h"
+
+namespace s21 {
+// Bounded multi-producer multi-consumer queue on a ring of cells. Every cell
+// carries a sequence number telling whose turn it is: a producer may fill
+// the cell for position pos once its sequence equals pos, a consumer may
+// empty it once the sequence equals pos + 1. Positions are claimed with a
+// CAS on the shared head or tail and handed back through the cell's own
+// sequence, so there are no locks and nothing is allocated after
+// construction.
+template <class T>
+class ConcurrentQueue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "a claimed cell cannot be given back, so moves must not throw");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // capacity is rounded up to a power of two
+  explicit ConcurrentQueue(size_type capacity)
+      : mask_(round_up(capacity) - 1), cells_(new Cell[mask_ + 1]) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    stats::on_allocate(kStats, (mask_ + 1) * sizeof(Cell));
+  }
+  ConcurrentQueue(const ConcurrentQueue&) = delete;
+  ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+  // must not race with other calls
+  ~ConcurrentQueue() {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    for (size_t pos = head_.load(std::memory_order_relaxed); pos != tail;
+         ++pos) {
+      cells_[pos & mask_].value()->~T();
+    }
+    delete[] cells_;
+    stats::on_free(kStats, (mask_ + 1) * sizeof(Cell));
+  }
+
+  // Queue Modifiers, each returns false instead of waiting
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+      size_t pos;
+      if (!claim(tail_, pos, 1, 0)) return false;
+      publish_push(pos, std::forward<Args>(args)...);
+      return true;
+    } else {
+      // build the value before a cell is claimed, so a throw changes nothing
+      T value(std::forward<Args>(args)...);
+      stats::on_construct<T, Args...>(kStats);
+      return try_emplace(std::move(value));
+    }
+  }
+  bool try_pop(reference out) { return pop_bulk(&out, 1) == 1; }
+
+  // Moves a prefix of [first, last) in with a single claim and returns its
+  // length, which is short when the queue fills up.
+  template <class ForwardIt>
+  size_type push_bulk(ForwardIt first, ForwardIt last) {
+    size_t count = std::min<size_t>(std::distance(first, last), mask_ + 1);
+    size_t pos;
+    size_t claimed = claim(tail_, pos, count, 0);
+    for (size_t i = 0; i < claimed; ++i, ++first) {
+      publish_push(pos + i, std::move(*first));
+    }
+    return claimed;
+  }
+  // Moves up to max_count elements to out with a single claim and returns
+  // how many. Writing through out must not throw.
+  template <class OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max_count) {
+    size_t pos;
+    size_t claimed = claim(head_, pos, std::min(max_count, mask_ + 1), 1);
+    for (size_t i = 0; i < claimed; ++i, ++out) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      *out = std::move(*cell.value());
+      cell.value()->~T();
+      cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    stats::on_move(kStats, claimed);
+    return claimed;
+  }
+
+  // Queue Capacity
+  size_type capacity() const { return mask_ + 1; }
+  // only a snapshot while other threads are pushing or popping
+  size_type size_approx() const {
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty_approx() const { return size_approx() == 0; }
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+  static constexpr stats::Kind kStats = stats::Kind::kConcurrentQueue;
+
+  struct Cell {
+    std::atomic<size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T* value() { return reinterpret_cast<T*>(storage); }
+  };
+
+  const size_t mask_;
+  Cell* const cells_;
+  // producers and consumers each hammer their own line
+  alignas(kCacheLine) std::atomic<size_t> tail_{0};
+  alignas(kCacheLine) std::atomic<size_t> head_{0};
+
+  static size_t round_up(size_t capacity) {
+    size_t result = 1;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  // Claims up to max consecutive cells starting at the current position of
+  // end (tail_ for producers with ready = 0, head_ for consumers with ready
+  // = 1), stopping at the first cell that is not ready yet. Returns the
+  // number claimed and their first position in pos; 0 means full or empty.
+  size_t claim(std::atomic<size_t>& end, size_t& pos, size_t max,
+               size_t ready) {
+    pos = end.load(std::memory_order_relaxed);
+    while (true) {
+      size_t count = 0;
+      std::ptrdiff_t diff = 0;
+      while (count < max) {
+        size_t sequence = cells_[(pos + count) & mask_].sequence.load(
+            std::memory_order_acquire);
+        diff = static_cast<std::ptrdiff_t>(sequence - (pos + count + ready));
+        if (diff != 0) break;
+        ++count;
+      }
+      if (count == 0) {
+        if (diff < 0 || max == 0) return 0;
+        // another thread took pos in the meantime
+        pos = end.load(std::memory_order_relaxed);
+      } else if (end.compare_exchange_weak(pos, pos + count,
+                                           std::memory_order_relaxed)) {
+        return count;
+      }
+    }
+  }
+
+  template <class... Args>
+  void publish_push(size_t pos, Args&&... args) {
+    Cell& cell = cells_[pos & mask_];
+    new (cell.storage) T(std::forward<Args>(args)...);
+    stats::on_construct<T, Args...>(kStats);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_QUEUE_H_
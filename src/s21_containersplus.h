@@ -1,8 +1,19 @@
 #ifndef SRC_S21_CONTAINERSPLUS_H_
 #define SRC_S21_CONTAINERSPLUS_H_
 
+#include "s21_arena.h"
 #include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_concurrent_queue.h"
 #include "s21_containers.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
 #include "s21_multiset.h"
+#include "s21_parallel.h"
+#include "s21_smallvector.h"
+#include "s21_stats.h"
+#include "s21_thread_pool.h"
+#include "s21_unordered_map.h"
+#include "s21_work_stealing_deque.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
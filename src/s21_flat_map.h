@@ -0,0 +1,263 @@
+#ifndef SRC_S21_FLAT_MAP_H_
+#define SRC_S21_FLAT_MAP_H_
+
+#include <tuple>
+
+#include "s21_flat_tree.h"
+#include "s21_helpsrc.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Map kept as a sorted s21::Vector of key/value pairs. Lookups binary search
+// contiguous memory; inserts and erases shift elements and invalidate every
+// iterator, so load it in bulk with from_unsorted, insert_many or the
+// initializer list, which sort once instead of shifting per element.
+//
+// Elements have to be move-assignable to be shifted and sorted, so the key in
+// value_type is not const. Changing it through an iterator breaks the order.
+template <typename Key, typename T>
+class FlatMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+ private:
+  using tree_type = FlatTree<key_type, value_type, KeySelectFirst<value_type>>;
+
+ public:
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  FlatMap();
+  FlatMap(std::initializer_list<value_type> const &items);
+  FlatMap(const FlatMap &m);
+  FlatMap(FlatMap &&m) noexcept;
+  ~FlatMap();
+  FlatMap &operator=(const FlatMap &m);
+  FlatMap &operator=(FlatMap &&m) noexcept;
+  // builds the map from any range with one sort, keeping the first of
+  // repeated keys
+  template <typename InputIt>
+  static FlatMap from_unsorted(InputIt first, InputIt last);
+
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type n);
+  void shrink_to_fit();
+  mapped_type const *find(key_type const &key) const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(key_type const &key, mapped_type const &obj);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);  // one sort for the whole range
+  std::pair<iterator, bool> insert_or_assign(key_type const &key,
+                                             mapped_type const &obj);
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+  void swap(FlatMap &other);
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const;
+  void merge(FlatMap &other);  // keys already here stay in other
+  iterator erase(const_iterator pos);  // returns the element after pos
+  size_type erase(const key_type &key);
+  template <typename... Args>
+  s21::Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  tree_type tree_;
+};
+/*---------------------definitions-------------*/
+template <typename Key, typename T>
+FlatMap<Key, T>::FlatMap() = default;
+template <typename Key, typename T>
+FlatMap<Key, T>::FlatMap(std::initializer_list<value_type> const &items) {
+  tree_.insert_unique_range(items.begin(), items.end());
+}
+template <typename Key, typename T>
+FlatMap<Key, T>::FlatMap(const FlatMap &m) = default;
+template <typename Key, typename T>
+FlatMap<Key, T>::FlatMap(FlatMap &&m) noexcept = default;
+template <typename Key, typename T>
+FlatMap<Key, T>::~FlatMap() = default;
+template <typename Key, typename T>
+FlatMap<Key, T> &FlatMap<Key, T>::operator=(const FlatMap &m) = default;
+template <typename Key, typename T>
+FlatMap<Key, T> &FlatMap<Key, T>::operator=(FlatMap &&m) noexcept = default;
+template <typename Key, typename T>
+template <typename InputIt>
+FlatMap<Key, T> FlatMap<Key, T>::from_unsorted(InputIt first, InputIt last) {
+  FlatMap result;
+  result.tree_.insert_unique_range(first, last);
+  return result;
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::begin() {
+  return tree_.begin();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::begin() const {
+  return tree_.begin();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::end() {
+  return tree_.end();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::end() const {
+  return tree_.end();
+}
+template <typename Key, typename T>
+bool FlatMap<Key, T>::empty() const {
+  return tree_.empty();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::size() const {
+  return tree_.size();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::max_size() const {
+  return tree_.max_size();
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::capacity() const {
+  return tree_.capacity();
+}
+template <typename Key, typename T>
+void FlatMap<Key, T>::reserve(size_type n) {
+  tree_.reserve(n);
+}
+template <typename Key, typename T>
+void FlatMap<Key, T>::shrink_to_fit() {
+  tree_.shrink_to_fit();
+}
+template <typename Key, typename T>
+T const *FlatMap<Key, T>::find(key_type const &key) const {
+  const_iterator it = tree_.find(key);
+  return it == tree_.end() ? nullptr : &it->second;
+}
+template <typename Key, typename T>
+void FlatMap<Key, T>::clear() {
+  tree_.clear();
+}
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool> FlatMap<Key, T>::insert(
+    const value_type &value) {
+  return tree_.emplace_unique(value.first, value);
+}
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool> FlatMap<Key, T>::insert(
+    key_type const &key, mapped_type const &obj) {
+  return tree_.emplace_unique(key, key, obj);
+}
+template <typename Key, typename T>
+template <typename InputIt>
+void FlatMap<Key, T>::insert(InputIt first, InputIt last) {
+  tree_.insert_unique_range(first, last);
+}
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool>
+FlatMap<Key, T>::insert_or_assign(key_type const &key,
+                                  mapped_type const &obj) {
+  auto result = tree_.emplace_unique(key, key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+template <typename Key, typename T>
+T &FlatMap<Key, T>::at(const key_type &key) {
+  iterator it = tree_.find(key);
+  if (it == tree_.end()) throw std::out_of_range("Key not found");
+  return it->second;
+}
+template <typename Key, typename T>
+const T &FlatMap<Key, T>::at(const key_type &key) const {
+  const T *value = find(key);
+  if (!value) throw std::out_of_range("Key not found");
+  return *value;
+}
+template <typename Key, typename T>
+T &FlatMap<Key, T>::operator[](const key_type &key) {
+  // the mapped value is only built when the key is missing
+  return tree_
+      .emplace_unique(key, std::piecewise_construct,
+                      std::forward_as_tuple(key), std::forward_as_tuple())
+      .first->second;
+}
+template <typename Key, typename T>
+void FlatMap<Key, T>::swap(FlatMap &other) {
+  tree_.swap(other.tree_);
+}
+template <typename Key, typename T>
+bool FlatMap<Key, T>::contains(const key_type &key) const {
+  return tree_.contains(key);
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::lower_bound(
+    const key_type &key) {
+  return tree_.lower_bound(key);
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::lower_bound(
+    const key_type &key) const {
+  return tree_.lower_bound(key);
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::upper_bound(
+    const key_type &key) {
+  return tree_.upper_bound(key);
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::upper_bound(
+    const key_type &key) const {
+  return tree_.upper_bound(key);
+}
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator,
+          typename FlatMap<Key, T>::iterator>
+FlatMap<Key, T>::equal_range(const key_type &key) {
+  return tree_.equal_range(key);
+}
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::const_iterator,
+          typename FlatMap<Key, T>::const_iterator>
+FlatMap<Key, T>::equal_range(const key_type &key) const {
+  return tree_.equal_range(key);
+}
+template <typename Key, typename T>
+void FlatMap<Key, T>::merge(FlatMap &other) {
+  tree_.merge_unique(other.tree_);
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::erase(const_iterator pos) {
+  return tree_.erase(tree_.begin() + (pos - tree_.begin()));
+}
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::erase(
+    const key_type &key) {
+  return tree_.erase(key);
+}
+template <typename Key, typename T>
+template <typename... Args>
+s21::Vector<std::pair<typename FlatMap<Key, T>::iterator, bool>>
+FlatMap<Key, T>::insert_many(Args &&...args) {
+  return tree_.insert_many_unique(std::forward<Args>(args)...);
+}
+}  // namespace s21
+#endif  // SRC_S21_FLAT_MAP_H_
@@ -0,0 +1,186 @@
+#ifndef SRC_S21_FLAT_SET_H_
+#define SRC_S21_FLAT_SET_H_
+
+#include "s21_flat_tree.h"
+#include "s21_helpsrc.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Set kept as a sorted s21::Vector. Lookups binary search contiguous memory;
+// inserts and erases shift elements and invalidate every iterator, so load it
+// in bulk with from_unsorted, insert_many or the initializer list, which sort
+// once instead of shifting per element.
+template <typename T>
+class FlatSet {
+  using tree_type = FlatTree<T, T, KeyIdentity<T>>;
+
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+
+  FlatSet();
+  FlatSet(std::initializer_list<value_type> const &items);
+  FlatSet(const FlatSet &other);
+  FlatSet(FlatSet &&other) noexcept;
+  ~FlatSet();
+  FlatSet &operator=(const FlatSet &other);
+  FlatSet &operator=(FlatSet &&other) noexcept;
+  // builds the set from any range with one sort, keeping the first of
+  // repeated keys
+  template <typename InputIt>
+  static FlatSet from_unsorted(InputIt first, InputIt last);
+
+  const_iterator begin() const;
+  const_iterator end() const;
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type n);
+  void shrink_to_fit();
+  void clear();
+
+  std::pair<iterator, bool> insert(const value_type &v);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);  // one sort for the whole range
+  iterator erase(const_iterator pos);  // returns the element after pos
+  size_type erase(const key_type &key);
+  void swap(FlatSet &other);
+  void merge(FlatSet &other);  // keys already here stay in other
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+
+  template <typename... Args>
+  Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  tree_type tree_;
+};
+/*---------------------definitions-------------*/
+template <typename T>
+FlatSet<T>::FlatSet() = default;
+template <typename T>
+FlatSet<T>::FlatSet(std::initializer_list<value_type> const &items) {
+  tree_.insert_unique_range(items.begin(), items.end());
+}
+template <typename T>
+FlatSet<T>::FlatSet(const FlatSet &other) = default;
+template <typename T>
+FlatSet<T>::FlatSet(FlatSet &&other) noexcept = default;
+template <typename T>
+FlatSet<T>::~FlatSet() = default;
+template <typename T>
+FlatSet<T> &FlatSet<T>::operator=(const FlatSet &other) = default;
+template <typename T>
+FlatSet<T> &FlatSet<T>::operator=(FlatSet &&other) noexcept = default;
+template <typename T>
+template <typename InputIt>
+FlatSet<T> FlatSet<T>::from_unsorted(InputIt first, InputIt last) {
+  FlatSet result;
+  result.tree_.insert_unique_range(first, last);
+  return result;
+}
+template <typename T>
+typename FlatSet<T>::const_iterator FlatSet<T>::begin() const {
+  return tree_.begin();
+}
+template <typename T>
+typename FlatSet<T>::const_iterator FlatSet<T>::end() const {
+  return tree_.end();
+}
+template <typename T>
+bool FlatSet<T>::empty() const {
+  return tree_.empty();
+}
+template <typename T>
+typename FlatSet<T>::size_type FlatSet<T>::size() const {
+  return tree_.size();
+}
+template <typename T>
+typename FlatSet<T>::size_type FlatSet<T>::max_size() const {
+  return tree_.max_size();
+}
+template <typename T>
+typename FlatSet<T>::size_type FlatSet<T>::capacity() const {
+  return tree_.capacity();
+}
+template <typename T>
+void FlatSet<T>::reserve(size_type n) {
+  tree_.reserve(n);
+}
+template <typename T>
+void FlatSet<T>::shrink_to_fit() {
+  tree_.shrink_to_fit();
+}
+template <typename T>
+void FlatSet<T>::clear() {
+  tree_.clear();
+}
+template <typename T>
+std::pair<typename FlatSet<T>::iterator, bool> FlatSet<T>::insert(
+    const value_type &v) {
+  return tree_.emplace_unique(v, v);
+}
+template <typename T>
+template <typename InputIt>
+void FlatSet<T>::insert(InputIt first, InputIt last) {
+  tree_.insert_unique_range(first, last);
+}
+template <typename T>
+typename FlatSet<T>::iterator FlatSet<T>::erase(const_iterator pos) {
+  return tree_.erase(tree_.begin() + (pos - tree_.begin()));
+}
+template <typename T>
+typename FlatSet<T>::size_type FlatSet<T>::erase(const key_type &key) {
+  return tree_.erase(key);
+}
+template <typename T>
+void FlatSet<T>::swap(FlatSet &other) {
+  tree_.swap(other.tree_);
+}
+template <typename T>
+void FlatSet<T>::merge(FlatSet &other) {
+  tree_.merge_unique(other.tree_);
+}
+template <typename T>
+typename FlatSet<T>::iterator FlatSet<T>::find(const key_type &key) const {
+  return tree_.find(key);
+}
+template <typename T>
+bool FlatSet<T>::contains(const key_type &key) const {
+  return tree_.contains(key);
+}
+template <typename T>
+typename FlatSet<T>::iterator FlatSet<T>::lower_bound(
+    const key_type &key) const {
+  return tree_.lower_bound(key);
+}
+template <typename T>
+typename FlatSet<T>::iterator FlatSet<T>::upper_bound(
+    const key_type &key) const {
+  return tree_.upper_bound(key);
+}
+template <typename T>
+std::pair<typename FlatSet<T>::iterator, typename FlatSet<T>::iterator>
+FlatSet<T>::equal_range(const key_type &key) const {
+  return tree_.equal_range(key);
+}
+template <typename T>
+template <typename... Args>
+Vector<std::pair<typename FlatSet<T>::iterator, bool>> FlatSet<T>::insert_many(
+    Args &&...args) {
+  auto positions = tree_.insert_many_unique(std::forward<Args>(args)...);
+  Vector<std::pair<iterator, bool>> result;
+  for (auto const &item : positions) result.push_back(item);
+  return result;
+}
+}  // namespace s21
+#endif  // SRC_S21_FLAT_SET_H_
@@ -0,0 +1,230 @@
+#ifndef SRC_S21_FLAT_TREE_H_
+#define SRC_S21_FLAT_TREE_H_
+
+#include "s21_helpsrc.h"
+#include "s21_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Sorted array used as the common engine of FlatSet and FlatMap. Elements sit
+// in one s21::Vector ordered by key with operator<, so lookups are a binary
+// search over contiguous memory and there is no per-element node overhead.
+// A single insert or erase shifts the tail, which makes the containers a fit
+// for data that is built in bulk and then mostly read.
+//
+// Every insert and erase may move elements, so iterators and references are
+// invalidated by any modification.
+template <typename Key, typename Value, typename KeyOfValue>
+class FlatTree {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+
+  FlatTree() = default;
+  FlatTree(const FlatTree &other) = default;
+  FlatTree(FlatTree &&other) noexcept = default;
+  FlatTree &operator=(const FlatTree &other);
+  FlatTree &operator=(FlatTree &&other) noexcept = default;
+
+  iterator begin() { return items_.begin(); }
+  const_iterator begin() const { return items_.begin(); }
+  iterator end() { return items_.end(); }
+  const_iterator end() const { return items_.end(); }
+
+  bool empty() const { return items_.empty(); }
+  size_type size() const { return items_.size(); }
+  size_type max_size() const { return items_.max_size(); }
+  size_type capacity() const { return items_.capacity(); }
+  void reserve(size_type n) { items_.reserve(n); }
+  void shrink_to_fit() { items_.shrink_to_fit(); }
+  void clear() { items_.clear(); }
+  void swap(FlatTree &other) { items_.swap(other.items_); }
+
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(const key_type &key,
+                                           Args &&...args);
+  // Appends [first, last), sorts the new tail, merges it into place and drops
+  // repeated keys keeping the earliest: elements already stored win over new
+  // ones, and among new ones the first wins.
+  template <typename InputIt>
+  void insert_unique_range(InputIt first, InputIt last);
+  template <typename... Args>
+  Vector<std::pair<iterator, bool>> insert_many_unique(Args &&...args);
+  // Moves over the elements of other whose keys are missing here; the rest
+  // stay in other.
+  void merge_unique(FlatTree &other);
+  iterator erase(iterator pos);
+  size_type erase(const key_type &key);
+
+ private:
+  static constexpr stats::Kind kStats = stats::Kind::kFlatTree;
+
+  // s21::Vector has no const accessors
+  mutable Vector<value_type> items_;
+
+  static bool less(const value_type &a, const value_type &b) {
+    return KeyOfValue()(a) < KeyOfValue()(b);
+  }
+  void truncate(iterator new_end);
+};
+/*---------------------definitions-------------*/
+template <typename Key, typename Value, typename KeyOfValue>
+FlatTree<Key, Value, KeyOfValue> &FlatTree<Key, Value, KeyOfValue>::operator=(
+    const FlatTree &other) {
+  if (this != &other) {
+    FlatTree copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+typename FlatTree<Key, Value, KeyOfValue>::iterator
+FlatTree<Key, Value, KeyOfValue>::lower_bound(const key_type &key) const {
+  size_t compared = 0;
+  iterator it = std::lower_bound(items_.begin(), items_.end(), key,
+                                 [&compared](const value_type &v,
+                                             const key_type &k) {
+                                   ++compared;
+                                   return KeyOfValue()(v) < k;
+                                 });
+  stats::on_lookup(kStats, compared);
+  return it;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+typename FlatTree<Key, Value, KeyOfValue>::iterator
+FlatTree<Key, Value, KeyOfValue>::upper_bound(const key_type &key) const {
+  size_t compared = 0;
+  iterator it = std::upper_bound(items_.begin(), items_.end(), key,
+                                 [&compared](const key_type &k,
+                                             const value_type &v) {
+                                   ++compared;
+                                   return k < KeyOfValue()(v);
+                                 });
+  stats::on_lookup(kStats, compared);
+  return it;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+std::pair<typename FlatTree<Key, Value, KeyOfValue>::iterator,
+          typename FlatTree<Key, Value, KeyOfValue>::iterator>
+FlatTree<Key, Value, KeyOfValue>::equal_range(const key_type &key) const {
+  iterator first = lower_bound(key);
+  iterator last = first;
+  if (last != items_.end() && !(key < KeyOfValue()(*last))) ++last;
+  return {first, last};
+}
+template <typename Key, typename Value, typename KeyOfValue>
+typename FlatTree<Key, Value, KeyOfValue>::iterator
+FlatTree<Key, Value, KeyOfValue>::find(const key_type &key) const {
+  iterator it = lower_bound(key);
+  if (it != items_.end() && !(key < KeyOfValue()(*it))) return it;
+  return items_.end();
+}
+template <typename Key, typename Value, typename KeyOfValue>
+bool FlatTree<Key, Value, KeyOfValue>::contains(const key_type &key) const {
+  return find(key) != items_.end();
+}
+template <typename Key, typename Value, typename KeyOfValue>
+template <typename... Args>
+std::pair<typename FlatTree<Key, Value, KeyOfValue>::iterator, bool>
+FlatTree<Key, Value, KeyOfValue>::emplace_unique(const key_type &key,
+                                                 Args &&...args) {
+  iterator it = lower_bound(key);
+  if (it != items_.end() && !(key < KeyOfValue()(*it))) return {it, false};
+  return {items_.emplace(it, std::forward<Args>(args)...), true};
+}
+template <typename Key, typename Value, typename KeyOfValue>
+template <typename InputIt>
+void FlatTree<Key, Value, KeyOfValue>::insert_unique_range(InputIt first,
+                                                           InputIt last) {
+  size_type old_size = items_.size();
+  for (; first != last; ++first) items_.emplace_back(*first);
+  if (items_.size() == old_size) return;
+  // stable steps keep the earliest of equal keys in front for std::unique
+  iterator middle = items_.begin() + old_size;
+  std::stable_sort(middle, items_.end(), less);
+  if (old_size != 0 && less(*middle, *(middle - 1))) {
+    std::inplace_merge(items_.begin(), middle, items_.end(), less);
+  }
+  truncate(std::unique(items_.begin(), items_.end(),
+                       [](const value_type &a, const value_type &b) {
+                         return !less(a, b);
+                       }));
+}
+template <typename Key, typename Value, typename KeyOfValue>
+template <typename... Args>
+Vector<std::pair<typename FlatTree<Key, Value, KeyOfValue>::iterator, bool>>
+FlatTree<Key, Value, KeyOfValue>::insert_many_unique(Args &&...args) {
+  Vector<value_type> batch;
+  (batch.emplace_back(std::forward<Args>(args)), ...);
+  Vector<key_type> keys;
+  Vector<size_type> order;
+  for (size_type i = 0; i < batch.size(); ++i) {
+    keys.push_back(KeyOfValue()(batch[i]));
+    order.push_back(i);
+  }
+  // only the first of each run of equal keys can be inserted
+  std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) {
+    return keys[a] < keys[b];
+  });
+  Vector<std::pair<iterator, bool>> result;
+  for (size_type i = 0; i < batch.size(); ++i) {
+    result.push_back({nullptr, false});
+  }
+  for (size_type i = 0; i < order.size(); ++i) {
+    if (i == 0 || keys[order[i - 1]] < keys[order[i]]) {
+      result[order[i]].second = !contains(keys[order[i]]);
+    }
+  }
+  insert_unique_range(std::make_move_iterator(batch.begin()),
+                      std::make_move_iterator(batch.end()));
+  // positions are only known once the whole batch is in place
+  for (size_type i = 0; i < keys.size(); ++i) result[i].first = find(keys[i]);
+  return result;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+void FlatTree<Key, Value, KeyOfValue>::merge_unique(FlatTree &other) {
+  if (this == &other) return;
+  Vector<value_type> missing;
+  iterator kept = other.begin();
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    if (contains(KeyOfValue()(*it))) {
+      if (kept != it) *kept = std::move(*it);
+      ++kept;
+    } else {
+      missing.push_back(std::move(*it));
+    }
+  }
+  other.truncate(kept);
+  insert_unique_range(std::make_move_iterator(missing.begin()),
+                      std::make_move_iterator(missing.end()));
+}
+template <typename Key, typename Value, typename KeyOfValue>
+typename FlatTree<Key, Value, KeyOfValue>::iterator
+FlatTree<Key, Value, KeyOfValue>::erase(iterator pos) {
+  std::move(pos + 1, items_.end(), pos);
+  items_.pop_back();
+  return pos;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+typename FlatTree<Key, Value, KeyOfValue>::size_type
+FlatTree<Key, Value, KeyOfValue>::erase(const key_type &key) {
+  iterator it = find(key);
+  if (it == items_.end()) return 0;
+  erase(it);
+  return 1;
+}
+template <typename Key, typename Value, typename KeyOfValue>
+void FlatTree<Key, Value, KeyOfValue>::truncate(iterator new_end) {
+  while (items_.end() != new_end) items_.pop_back();
+}
+}  // namespace s21
+#endif  // SRC_S21_FLAT_TREE_H_
@@ -7,15 +7,48 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <list>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+namespace s21 {
+// Containers swap their allocators only when the allocator asks for it, as
+// the standard ones do. std::pmr::polymorphic_allocator does not propagate
+// and cannot even be assigned.
+template <typename Alloc>
+void swap_allocators(Alloc& a, Alloc& b) noexcept {
+  using traits = std::allocator_traits<Alloc>;
+  if constexpr (traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(a, b);
+  }
+}
+
+// Comparators that declare is_transparent, as std::less<> does, can compare
+// keys against other types; Q only makes the check depend on the caller.
+template <typename Compare, typename Q, typename = void>
+struct is_transparent : std::false_type {};
+template <typename Compare, typename Q>
+struct is_transparent<Compare, Q, std::void_t<typename Compare::is_transparent>>
+    : std::true_type {};
+
+// Allocators whose deallocate is a no-op, because their owner hands all of
+// the memory back at once, say so with an is_bulk_release member type.
+template <typename Alloc, typename = void>
+struct releases_in_bulk : std::false_type {};
+template <typename Alloc>
+struct releases_in_bulk<Alloc, std::void_t<typename Alloc::is_bulk_release>>
+    : Alloc::is_bulk_release {};
+}  // namespace s21
+
 #endif  // SRC_S21_HELPSRC_H_
\ No newline at end of file
@@ -2,11 +2,12 @@
 #define SRC_S21_CONTAINERS_OOP_H_
 
 #include "s21_helpsrc.h"
+#include "s21_stats.h"
 
 namespace s21 {
-template <class T>
+template <class T, class Alloc = std::allocator<T>>
 class List {
-  using A = class std::allocator<T>;
+  using A = Alloc;
 
  public:
   template <class value_type>
@@ -24,7 +25,13 @@ class List {
     }
   };
   using node_allocator =
-      typename std::allocator_traits<A>::template rebind_alloc<List>;
+      typename std::allocator_traits<A>::template rebind_alloc<Node<T>>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  // with an arena-style allocator, clear just unhooks trivially destructible
+  // nodes
+  static constexpr bool kSkipTeardown =
+      releases_in_bulk<node_allocator>::value &&
+      std::is_trivially_destructible_v<T>;
   node_allocator allocator;
   /*-----------------------------------------iterators  ------*/
  public:
@@ -95,7 +102,7 @@ class List {
 
    private:
     Node<value_type>* IterPointer_;
-    friend class List<value_type>;
+    friend class List;
   };
 
  public:
@@ -162,7 +169,7 @@ class List {
 
    private:
     const Node<value_type>* IterPointer_;
-    friend class List<value_type>;
+    friend class List;
   };
   /*---------------------------end of block "iterators"--------------------*/
  public:
@@ -170,10 +177,13 @@ class List {
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
+  using allocator_type = Alloc;
   List();
+  explicit List(const allocator_type& alloc);
   List(const List& l);
   List(List&& l) noexcept;
-  List(std::initializer_list<value_type> const& items);
+  List(std::initializer_list<value_type> const& items,
+       const allocator_type& alloc = allocator_type());
   List(size_type n);
   ~List();
   List& operator=(const List& l);
@@ -195,10 +205,12 @@ class List {
   void pop_front();
   void Swap(List& l);
   void reverse();
-  void Merge(List& other);
-  void Splice(iterator pos, List<value_type>& other);
+  template <typename Compare = std::less<value_type>>
+  void Merge(List& other, Compare comp = Compare());
+  void Splice(iterator pos, List<value_type, Alloc>& other);
   void unique();
-  void Sort();
+  template <typename Compare = std::less<value_type>>
+  void Sort(Compare comp = Compare());
   void insert(iterator pos, const_reference data);
   void erase(iterator pos);
   template <typename... Args>
@@ -209,52 +221,65 @@ class List {
   void insert_many_front(Args&&... args);
   void initializeFields();
   void print();
+  allocator_type get_allocator() const;
   //  iterator my_next(typename s21::List<T>::iterator it, int n = 1);
   int Size;
   Node<value_type>* head;
   Node<value_type>* tail;
+
+ private:
+  static constexpr stats::Kind kStats = stats::Kind::kList;
+
+  template <typename... Args>
+  Node<value_type>* create_node(Args&&... args);
+  void destroy_node(Node<value_type>* node) noexcept;
+  void relink(Node<value_type>* first);
+  template <typename Compare>
+  static Node<value_type>* merge_runs(Node<value_type>* first,
+                                      Node<value_type>* second, Compare& comp);
 };
-template <typename value_type>
-List<value_type>::List() {
-  tail = new Node<value_type>();
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List() : List(allocator_type()) {}
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List(const allocator_type& alloc) : allocator(alloc) {
+  tail = create_node();
   head = tail;
   Size = 0;
 }
-template <typename value_type>
-List<value_type>::List(const List& l) : List() {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List(const List& l)
+    : List(node_traits::select_on_container_copy_construction(l.allocator)) {
   operator=(l);
 }
-template <typename value_type>
-List<value_type>::List(List&& l) noexcept : List() {
-  clear();
-  head = l.head;
-  tail = l.tail;
-  Size = l.Size;
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List(List&& l) noexcept
+    : allocator(l.allocator), Size(l.Size), head(l.head), tail(l.tail) {
   l.head = NULL;
   l.tail = NULL;
   l.Size = 0;
 }
-template <typename value_type>
-List<value_type>::List(std::initializer_list<value_type> const& items)
-    : List() {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List(std::initializer_list<value_type> const& items,
+                              const allocator_type& alloc)
+    : List(alloc) {
   for (const auto& element : items) {
     push_back(element);
   }
 }
-template <typename value_type>
-List<value_type>::List(size_type n) : List() {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::List(size_type n) : List() {
   for (size_type i = 0; i < n; i++) {
     push_back(value_type());
   }
 }
 
-template <typename value_type>
-List<value_type>::~List() {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>::~List() {
   clear();
-  delete tail;
+  destroy_node(tail);
 }
-template <typename value_type>
-List<value_type>& List<value_type>::operator=(const List& l) {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>& List<value_type, Alloc>::operator=(const List& l) {
   clear();
   iterator currentPtr = l.begin();
   while (currentPtr != l.end()) {
@@ -264,8 +289,8 @@ List<value_type>& List<value_type>::operator=(const List& l) {
   return *this;
 }
 
-template <typename value_type>
-List<value_type>& List<value_type>::operator=(List&& l) noexcept {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>& List<value_type, Alloc>::operator=(List&& l) noexcept {
   clear();
   iterator currentPtr = l.begin();
   while (currentPtr != l.end()) {
@@ -276,8 +301,8 @@ List<value_type>& List<value_type>::operator=(List&& l) noexcept {
   s21::List(std::move(l));
   return *this;
 }
-template <typename value_type>
-List<value_type>& List<value_type>::operator+(const List& l) {
+template <typename value_type, typename Alloc>
+List<value_type, Alloc>& List<value_type, Alloc>::operator+(const List& l) {
   // 1) get access to the list "l"
   iterator temp = l.begin();
   // 2) add nodes temp to the l list
@@ -288,48 +313,61 @@ List<value_type>& List<value_type>::operator+(const List& l) {
   // 3.return unified list
   return *this;
 }
-template <typename value_type>
-void List<value_type>::print() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::print() {
   for (Node<value_type>* node = head; node != tail; node = node->pNext) {
     std::cout << node->data << " ";
   }
   std::cout << std::endl;
 }
-template <typename value_type>
-typename List<value_type>::const_reference List<value_type>::front() {
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::const_reference
+List<value_type, Alloc>::front() {
   return this->head->data;
 }
-template <typename value_type>
-typename List<value_type>::const_reference List<value_type>::back() {
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::const_reference
+List<value_type, Alloc>::back() {
   return this->tail->pPrev->data;
 }
-template <typename value_type>
-typename List<value_type>::iterator List<value_type>::begin() const {
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::iterator
+List<value_type, Alloc>::begin() const {
   return iterator(this->head);
 }
-template <typename value_type>
-typename List<value_type>::iterator List<value_type>::end() const {
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::iterator
+List<value_type, Alloc>::end() const {
   return iterator(this->tail);
 }
-template <typename value_type>
-bool List<value_type>::empty() {
+template <typename value_type, typename Alloc>
+bool List<value_type, Alloc>::empty() {
   return size() == 0;
 }
-template <typename value_type>
-typename List<value_type>::size_type List<value_type>::size() {
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::size_type List<value_type, Alloc>::size() {
   return Size;
 }
-template <typename value_type>
-typename List<value_type>::size_type List<value_type>::max_size() {
-  return allocator.max_size();
-}
-template <typename value_type>
-void List<value_type>::clear() {
-  while (Size) pop_front();
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::size_type
+List<value_type, Alloc>::max_size() {
+  return node_traits::max_size(allocator);
+}
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::clear() {
+  if constexpr (kSkipTeardown) {
+    if (Size) {
+      head = tail;
+      tail->pPrev = nullptr;
+      Size = 0;
+    }
+  } else {
+    while (Size) pop_front();
+  }
 }
-template <typename value_type>
-void List<value_type>::push_back(const_reference data) {
-  Node<value_type>* ptr = new Node<value_type>(data);
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::push_back(const_reference data) {
+  Node<value_type>* ptr = create_node(data);
   ptr->pNext = tail;
   if (Size != 0) {
     tail->pPrev->pNext = ptr;
@@ -341,9 +379,9 @@ void List<value_type>::push_back(const_reference data) {
   }
   Size++;
 }
-template <typename value_type>
-void List<value_type>::push_front(const_reference data) {
-  Node<value_type>* ptr = new Node<value_type>(data);
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::push_front(const_reference data) {
+  Node<value_type>* ptr = create_node(data);
   ptr->pNext = head;
   if (head != NULL) {
     head->pPrev = ptr;
@@ -357,8 +395,8 @@ void List<value_type>::push_front(const_reference data) {
   ptr->pPrev = NULL;
   Size++;
 }
-template <typename value_type>
-void List<value_type>::pop_back() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::pop_back() {
   Node<value_type>* ptr = tail->pPrev;
   if (ptr == nullptr) {
     return;
@@ -370,11 +408,11 @@ void List<value_type>::pop_back() {
     tail->pPrev->pPrev->pNext = tail;
     tail->pPrev = tail->pPrev->pPrev;
   }
-  delete ptr;
+  destroy_node(ptr);
   Size--;
 }
-template <typename value_type>
-void List<value_type>::pop_front() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::pop_front() {
   {
     if (head == NULL) return;
     Node<value_type>* ptr = head->pNext;
@@ -383,19 +421,20 @@ void List<value_type>::pop_front() {
     } else {
       tail = ptr;
     }
-    delete head;
+    destroy_node(head);
     head = ptr;
     Size--;
   }
 }
-template <typename value_type>
-void List<value_type>::Swap(List& l) {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::Swap(List& l) {
   std::swap(this->head, l.head);
   std::swap(this->tail, l.tail);
   std::swap(this->Size, l.Size);
+  swap_allocators(this->allocator, l.allocator);
 }
-template <typename value_type>
-void List<value_type>::reverse() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::reverse() {
   Node<value_type>* currentNode = head;
   Node<value_type>* nextNode;
   if (head == nullptr) {
@@ -414,14 +453,47 @@ void List<value_type>::reverse() {
   }
 }
 
-template <typename value_type>
-void List<value_type>::Merge(List& other) {
-  this->operator+(other);
-  this->Sort();
+// Merges two sorted lists in one pass by moving the nodes of other into this
+// list, leaving other empty. Equal elements of this list stay in front.
+template <typename value_type, typename Alloc>
+template <typename Compare>
+void List<value_type, Alloc>::Merge(List& other, Compare comp) {
+  if (this == &other || other.Size == 0) return;
+  if (!(allocator == other.allocator)) {
+    // nodes cannot change pools, so bring them into ours first
+    List nodes(get_allocator());
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      nodes.push_back(*it);
+    }
+    other.clear();
+    Merge(nodes, comp);
+    return;
+  }
+  Node<value_type>* mine = nullptr;
+  if (Size != 0) {
+    tail->pPrev->pNext = nullptr;
+    mine = head;
+  }
+  other.tail->pPrev->pNext = nullptr;
+  Node<value_type>* theirs = other.head;
+  other.head = other.tail;
+  other.tail->pPrev = nullptr;
+  Size += other.Size;
+  other.Size = 0;
+  relink(merge_runs(mine, theirs, comp));
 }
-template <typename value_type>
-void List<value_type>::Splice(iterator pos, List<value_type>& other) {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::Splice(iterator pos,
+                                     List<value_type, Alloc>& other) {
   if (!other.head || !other.tail->pPrev) return;  // if other.empty()
+  if (!(allocator == other.allocator)) {
+    // nodes cannot change pools, so copy the values over instead
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      insert(pos, *it);
+    }
+    other.clear();
+    return;
+  }
 
   Node<value_type>* startNode = other.head;
   Node<value_type>* endNode = other.tail->pPrev;
@@ -437,10 +509,11 @@ void List<value_type>::Splice(iterator pos, List<value_type>& other) {
   other.Size = 0;
   other.head = nullptr;
   // other.tail->pPrev = other.tail;
+  other.destroy_node(other.tail);
   other.tail = nullptr;
 }
-template <typename value_type>
-void List<value_type>::unique() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::unique() {
   if (head == nullptr) {
     return;
   }
@@ -452,7 +525,7 @@ void List<value_type>::unique() {
       Node<value_type>* temp = nextNode;
       nextNode = nextNode->pNext;
       if (nextNode != nullptr) nextNode->pPrev = currentNode;
-      delete temp;
+      destroy_node(temp);
       Size--;
     }
     currentNode->pNext = nextNode;
@@ -460,39 +533,42 @@ void List<value_type>::unique() {
     currentNode = nextNode;
   }
 }
-template <typename value_type>
-void List<value_type>::Sort() {
-  bool SwapDone = true;  //  activated when swapped, default: on
-  Node<value_type>* currNode;
-  if (head == NULL)  // if list is empty, exit
-  {
-    return;
-  }
-  while (SwapDone) {
-    currNode = head;   // we start from head
-    SwapDone = false;  // reset for each iteration
-    while (currNode->pNext != tail) {
-      if (currNode->data >
-          currNode->pNext->data) {  // if the next element is less
-        value_type temp = currNode->data;
-        currNode->data = currNode->pNext->data;
-        currNode->pNext->data = temp;
-        SwapDone = true;  //  the swap is done and switch the flag
-      }
-      currNode = currNode->pNext;  // move next
+// Stable bottom-up merge sort. Only pNext/pPrev are relinked, the elements
+// themselves are never copied or moved. bins[i] holds a sorted run of 2^i
+// nodes, so at most 64 runs are pending at any time.
+template <typename value_type, typename Alloc>
+template <typename Compare>
+void List<value_type, Alloc>::Sort(Compare comp) {
+  if (Size < 2) return;
+  Node<value_type>* bins[64] = {};
+  Node<value_type>* rest = head;
+  tail->pPrev->pNext = nullptr;
+  while (rest) {
+    Node<value_type>* run = rest;
+    rest = rest->pNext;
+    run->pNext = nullptr;
+    size_t i = 0;
+    for (; bins[i]; ++i) {
+      run = merge_runs(bins[i], run, comp);
+      bins[i] = nullptr;
     }
-    tail->pPrev = currNode;  //  mark the last swapped node
+    bins[i] = run;
+  }
+  Node<value_type>* sorted = nullptr;
+  for (Node<value_type>* run : bins) {
+    if (run) sorted = sorted ? merge_runs(run, sorted, comp) : run;
   }
+  relink(sorted);
 }
-template <typename value_type>
-void List<value_type>::initializeFields() {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::initializeFields() {
   Size = 0;
   head = nullptr;
   tail = nullptr;
 }
-template <typename value_type>
-void List<value_type>::insert(iterator pos, const_reference data) {
-  Node<value_type>* newNode = new Node<value_type>(data);
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::insert(iterator pos, const_reference data) {
+  Node<value_type>* newNode = create_node(data);
   iterator posNode = pos.IterPointer_;
   if (posNode != begin()) {
     newNode->pPrev = posNode.getIterPointer()->pPrev;
@@ -506,8 +582,8 @@ void List<value_type>::insert(iterator pos, const_reference data) {
   }
   ++Size;
 }
-template <typename value_type>
-void List<value_type>::erase(iterator pos) {
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::erase(iterator pos) {
   if (pos == end()) {
     return;
   }
@@ -515,22 +591,81 @@ void List<value_type>::erase(iterator pos) {
     pop_front();
     return;
   }
-  for (auto current = head; current != tail; current = current->pNext) {
-    if (current->pNext == pos.getIterPointer()) {
-      current->pNext = pos.getIterPointer()->pNext;
-      delete pos.getIterPointer();
-      Size--;
-      return;
+  Node<value_type>* node = pos.getIterPointer();
+  node->pPrev->pNext = node->pNext;
+  node->pNext->pPrev = node->pPrev;
+  destroy_node(node);
+  Size--;
+}
+template <typename value_type, typename Alloc>
+typename List<value_type, Alloc>::allocator_type
+List<value_type, Alloc>::get_allocator() const {
+  return allocator_type(allocator);
+}
+template <typename value_type, typename Alloc>
+template <typename... Args>
+typename List<value_type, Alloc>::template Node<value_type>*
+List<value_type, Alloc>::create_node(Args&&... args) {
+  Node<value_type>* node = node_traits::allocate(allocator, 1);
+  try {
+    node_traits::construct(allocator, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(allocator, node, 1);
+    throw;
+  }
+  stats::on_allocate(kStats, sizeof(Node<value_type>));
+  stats::on_construct<value_type, Args...>(kStats);
+  return node;
+}
+// makes the null-terminated pNext chain starting at first the content of the
+// list: restores every pPrev and hangs the chain in front of the sentinel
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::relink(Node<value_type>* first) {
+  head = first;
+  Node<value_type>* prev = nullptr;
+  for (Node<value_type>* node = head; node; node = node->pNext) {
+    node->pPrev = prev;
+    prev = node;
+  }
+  prev->pNext = tail;
+  tail->pPrev = prev;
+}
+// merges two null-terminated sorted runs linked through pNext; on ties the
+// node from first (the earlier run) goes first
+template <typename value_type, typename Alloc>
+template <typename Compare>
+typename List<value_type, Alloc>::template Node<value_type>*
+List<value_type, Alloc>::merge_runs(Node<value_type>* first,
+                                    Node<value_type>* second, Compare& comp) {
+  Node<value_type>* result = nullptr;
+  Node<value_type>** link = &result;
+  while (first && second) {
+    if (comp(second->data, first->data)) {
+      *link = second;
+      second = second->pNext;
+    } else {
+      *link = first;
+      first = first->pNext;
     }
+    link = &(*link)->pNext;
   }
+  *link = first ? first : second;
+  return result;
+}
+template <typename value_type, typename Alloc>
+void List<value_type, Alloc>::destroy_node(Node<value_type>* node) noexcept {
+  if (!node) return;
+  node_traits::destroy(allocator, node);
+  node_traits::deallocate(allocator, node, 1);
+  stats::on_free(kStats, sizeof(Node<value_type>));
 }
 /*----------BONUS---------------*/
-template <typename value_type>
+template <typename value_type, typename Alloc>
 template <typename... Args>
-typename List<value_type>::iterator List<value_type>::insert_many(
+typename List<value_type, Alloc>::iterator List<value_type, Alloc>::insert_many(
     iterator pos, Args&&... args) {
   Node<value_type>* nodeIn = pos.IterPointer_;
-  Node<value_type>* newNode = new Node<value_type>(std::forward<Args>(args)...);
+  Node<value_type>* newNode = create_node(std::forward<Args>(args)...);
   newNode->pPrev = nodeIn->pPrev;
   newNode->pNext = nodeIn;
   if (nodeIn->pPrev) {
@@ -542,20 +677,25 @@ typename List<value_type>::iterator List<value_type>::insert_many(
   Size++;
   return iterator(newNode);
 }
-template <typename value_type>
+template <typename value_type, typename Alloc>
 template <typename... Args>
-void List<value_type>::insert_many_back(Args&&... args) {
+void List<value_type, Alloc>::insert_many_back(Args&&... args) {
   for (auto newData : {std::forward<Args>(args)...}) {
     push_back(newData);
   }
 }
-template <typename value_type>
+template <typename value_type, typename Alloc>
 template <typename... Args>
-void List<value_type>::insert_many_front(Args&&... args) {
+void List<value_type, Alloc>::insert_many_front(Args&&... args) {
   for (auto newData : {std::forward<Args>(args)...}) {
     push_front(newData);
   }
 }
+
+namespace pmr {
+template <typename T>
+using List = s21::List<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // SRC_S21_CONTAINERS_OOP_H_
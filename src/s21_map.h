@@ -2,10 +2,12 @@
 #define SRC_S21_CONTAINERS_MAP_H_
 
 #include "s21_helpsrc.h"
+#include "s21_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<std::pair<const Key, T>>>
 class Map {
  public:
   using key_type = Key;
@@ -14,574 +16,481 @@ class Map {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Alloc;
 
- public:
-  template <class value_type>
-  class Node {
-   public:
-    value_type data;
-    Node *left;
-    Node *right;
-    Node *parent;
+ private:
+  using tree_type =
+      Tree<key_type, value_type, KeySelectFirst<value_type>, Compare, Alloc>;
+  template <typename Q, typename R>
+  using if_transparent = typename tree_type::template if_transparent<Q, R>;
 
-   public:
-    Node(value_type const &item, Node *l, Node *r, Node *p)
-        : data(item), left(l), right(r), parent(p) {}
-  };
+ public:
+  using Node = typename tree_type::Node;
+  using MapIterator = typename tree_type::iterator;
+  using MapConstIterator = typename tree_type::const_iterator;
+  using const_iterator = MapConstIterator;
+  using iterator = MapIterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
  public:
   Map();
-  Map(std::initializer_list<value_type> const &items);
+  explicit Map(const allocator_type &alloc);
+  explicit Map(const key_compare &comp,
+               const allocator_type &alloc = allocator_type());
+  Map(std::initializer_list<value_type> const &items,
+      const allocator_type &alloc = allocator_type());
   Map(const Map &m);
   Map(Map &&m);
   ~Map();
   Map &operator=(const Map &m);
   Map &operator=(Map &&m);
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
+  // builds the map from a range sorted by key in O(n)
+  template <typename ForwardIt>
+  static Map from_sorted(ForwardIt first, ForwardIt last);
   bool empty();
   size_type Size();
   size_type max_size();
   mapped_type const *find(key_type const &key) const;
 
-  class MapIterator {
-   public:
-    using iterator = MapIterator;
-    MapIterator() : current_(nullptr) {}
-    MapIterator(Node<value_type> *node) : current_(node) {}
-    value_type const &operator*() const { return current_->data; }
-    value_type const operator->() const { return current_->data; }
-    MapIterator &operator++() {
-      if (current_->right) {
-        current_ = current_->right;
-        while (current_->left) {
-          current_ = current_->left;
-        }
-      } else {
-        auto parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-
-    MapIterator operator++(int) {
-      if (current_->right) {
-        current_ = current_->right;
-        while (current_->left) {
-          current_ = current_->left;
-        }
-      } else {
-        auto parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-
-    MapIterator &operator--() {
-      if (current_->left) {
-        current_ = current_->left;
-        while (current_->right) {
-          current_ = current_->right;
-        }
-      } else {
-        Node<value_type> *parent = current_->parent;
-        while (parent && current_ == parent->left) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-
-    bool operator==(MapIterator const &other) const {
-      return current_ == other.current_;
-    }
-    bool operator!=(MapIterator const &other) const {
-      return !(*this == other);
-    }
-
-   private:
-    Node<value_type> *current_;
-    friend class Map<key_type, mapped_type>;
-  };  // interator end
-
-  class MapConstIterator {
-   public:
-    using const_iterator = MapConstIterator;
-    MapConstIterator() : current_(nullptr) {}
-    MapConstIterator(Node<value_type> *node) : current_(node) {}
-    value_type const &operator*() const { return current_->data; }
-    value_type const operator->() const { return current_->data; }
-    const_iterator &operator++() {
-      if (current_->right) {
-        current_ = current_->right;
-        while (current_->left) {
-          current_ = current_->left;
-        }
-      } else {
-        auto parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-    const_iterator operator++(int) {
-      if (current_->right) {
-        current_ = current_->right;
-        while (current_->left) {
-          current_ = current_->left;
-        }
-      } else {
-        auto parent = current_->parent;
-        while (parent && current_ == parent->right) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-
-    const_iterator &operator--() {
-      if (current_->left) {
-        current_ = current_->left;
-        while (current_->right) {
-          current_ = current_->right;
-        }
-      } else {
-        Node<value_type> *parent = current_->parent;
-        while (parent && current_ == parent->left) {
-          current_ = parent;
-          parent = parent->parent;
-        }
-        current_ = parent;
-      }
-      return *this;
-    }
-
-    bool operator==(const const_iterator &other) const {
-      return current_ == other.current_;
-    }
-    bool operator!=(const const_iterator &other) const {
-      return !(*this == other);
-    }
-
-   private:
-    Node<value_type> *current_;
-    friend class Map<key_type, mapped_type>;
-  };  // interator end
-
-  using const_iterator = MapConstIterator;
-  using iterator = MapIterator;
   MapConstIterator begin() const;
   MapIterator begin();
   MapConstIterator end() const;
   MapIterator end();
+  reverse_iterator rbegin();  // the largest key first, in O(1)
+  const_reverse_iterator rbegin() const;
+  reverse_iterator rend();
+  const_reverse_iterator rend() const;
+  reference front();  // the smallest key, in O(1)
+  const_reference front() const;
+  reference back();  // the largest key, in O(1)
+  const_reference back() const;
 
  public:
-  void clear(Node<value_type> *node);
   void clear();
-  void insert(Node<value_type> *&node, value_type const &item,
-              Node<value_type> *parent = nullptr);
   std::pair<iterator, bool> insert(const value_type &value);
   std::pair<iterator, bool> insert(key_type const &key, mapped_type const &obj);
+  iterator insert(const_iterator hint, const value_type &value);
+  insert_return_type insert(node_type &&nh);
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type &key);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
   std::pair<iterator, bool> insert_or_assign(key_type const &key,
                                              mapped_type const &obj);
   mapped_type &at(const key_type &key);
   mapped_type &operator[](const key_type &key);
   void swap(Map &other);
   bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const;
+  // lookups by any key type a transparent Compare such as std::less<> takes
+  template <typename Q>
+  if_transparent<Q, mapped_type const *> find(const Q &key) const {
+    auto it = tree_.find(key);
+    return it == tree_.end() ? nullptr : &(*it).second;
+  }
+  template <typename Q>
+  if_transparent<Q, bool> contains(const Q &key) const {
+    return tree_.contains(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> lower_bound(const Q &key) {
+    return tree_.lower_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, const_iterator> lower_bound(const Q &key) const {
+    return tree_.lower_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> upper_bound(const Q &key) {
+    return tree_.upper_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, const_iterator> upper_bound(const Q &key) const {
+    return tree_.upper_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<iterator, iterator>> equal_range(const Q &key) {
+    return tree_.equal_range(key);
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<const_iterator, const_iterator>> equal_range(
+      const Q &key) const {
+    return tree_.equal_range(key);
+  }
   void merge(Map &other);
   void erase(iterator pos);
+  TreeDebugStats debug_stats() const;  // height and depths, visits every node
+  double sampled_depth(size_type samples = 64) const;  // estimated avg depth
   template <typename... Args>
   s21::Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
  private:
-  Node<value_type> *root_;
-  size_type size = 0;
-  Node<value_type> *find_node(Node<value_type> *node,
-                              const key_type &key) const;
-  mapped_type const *find(Node<value_type> *node, key_type const &key) const;
-  void transplant(Node<value_type> *u, Node<value_type> *v);
-  Node<value_type> *minimum(Node<value_type> *x) const;
-  Node<value_type> *successor(Node<value_type> *x) const;
+  tree_type tree_;
 };
 /*---------------------definitions-------------*/
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type>::Map() : root_(nullptr) {}
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type>::Map(std::initializer_list<value_type> const &items)
-    : Map() {
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map() : tree_() {}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map(const allocator_type &alloc)
+    : tree_(alloc) {}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map(const key_compare &comp,
+                                                const allocator_type &alloc)
+    : tree_(comp, alloc) {}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map(
+    std::initializer_list<value_type> const &items, const allocator_type &alloc)
+    : Map(alloc) {
   for (auto const &item : items) {
     insert(item);
   }
 }
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type>::Map(const Map &m) : Map() {
-  for (auto const &item : m) {
-    insert(item);
-  }
-}
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type>::Map(Map &&m) : root_(m.root_) {
-  m.root_ = nullptr;
-  m.size = 0;
-}
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type>::~Map() {
-  clear(root_);
-}
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type> &Map<key_type, mapped_type>::operator=(
-    const Map &m) {
-  if (this != &m) {
-    Map tmp(m);
-    swap(tmp);
-  }
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map(const Map &m)
+    : tree_(m.tree_) {}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::Map(Map &&m)
+    : tree_(std::move(m.tree_)) {}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::~Map() = default;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc> &
+Map<key_type, mapped_type, Compare, Alloc>::operator=(const Map &m) {
+  tree_ = m.tree_;
   return *this;
 }
-template <typename key_type, typename mapped_type>
-Map<key_type, mapped_type> &Map<key_type, mapped_type>::operator=(Map &&m) {
-  if (this != &m) {
-    clear(root_);
-    root_ = m.root_;
-    m.root_ = nullptr;
-  }
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Map<key_type, mapped_type, Compare, Alloc> &
+Map<key_type, mapped_type, Compare, Alloc>::operator=(Map &&m) {
+  tree_ = std::move(m.tree_);
   return *this;
 }
-template <typename key_type, typename mapped_type>
-inline typename Map<key_type, mapped_type>::size_type
-Map<key_type, mapped_type>::max_size() {
-  std::allocator<std::pair<key_type, mapped_type>> Alloc;
-  return std::allocator_traits<decltype(Alloc)>::max_size(Alloc) / 5;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Alloc Map<key_type, mapped_type, Compare, Alloc>::get_allocator() const {
+  return tree_.get_allocator();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+Compare Map<key_type, mapped_type, Compare, Alloc>::key_comp() const {
+  return tree_.key_comp();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+template <typename ForwardIt>
+Map<key_type, mapped_type, Compare, Alloc>
+Map<key_type, mapped_type, Compare, Alloc>::from_sorted(
+    ForwardIt first, ForwardIt last) {
+  Map result;
+  result.assign_sorted(first, last);
+  return result;
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename Map<key_type, mapped_type, Compare, Alloc>::size_type
+Map<key_type, mapped_type, Compare, Alloc>::max_size() {
+  Alloc alloc = tree_.get_allocator();
+  return std::allocator_traits<Alloc>::max_size(alloc) / 5;
 }
-template <typename key_type, typename mapped_type>
-const mapped_type *s21::Map<key_type, mapped_type>::find(
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+const mapped_type *s21::Map<key_type, mapped_type, Compare, Alloc>::find(
     key_type const &key) const {
-  return find(root_, key);
+  auto it = tree_.find(key);
+  return it == tree_.end() ? nullptr : &(*it).second;
 }
-template <typename key_type, typename mapped_type>
-bool s21::Map<key_type, mapped_type>::empty() {
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+bool s21::Map<key_type, mapped_type, Compare, Alloc>::empty() {
   return Size() == 0;
 }
 
-template <typename key_type, typename mapped_type>
-size_t s21::Map<key_type, mapped_type>::Size() {
-  return size;
-}
-template <typename key_type, typename mapped_type>
-inline typename s21::Map<key_type, mapped_type>::const_iterator
-s21::Map<key_type, mapped_type>::begin() const {
-  if (!root_) {
-    return const_iterator(nullptr);
-  }
-  Node<value_type> *cur = root_;
-  while (cur->left) {
-    cur = cur->left;
-  }
-  return const_iterator(cur);
-}
-template <typename key_type, typename mapped_type>
-inline typename s21::Map<key_type, mapped_type>::iterator
-s21::Map<key_type, mapped_type>::begin() {
-  if (!root_) {
-    return iterator(nullptr);
-  }
-  Node<value_type> *cur = root_;
-  while (cur->left) {
-    cur = cur->left;
-  }
-  return iterator(cur);
-}
-template <typename key_type, typename mapped_type>
-inline typename s21::Map<key_type, mapped_type>::const_iterator
-s21::Map<key_type, mapped_type>::end() const {
-  return const_iterator(nullptr);
-}
-template <typename key_type, typename mapped_type>
-inline typename s21::Map<key_type, mapped_type>::iterator
-s21::Map<key_type, mapped_type>::end() {
-  return iterator(nullptr);
-}
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::clear(Node<value_type> *node) {
-  if (node) {
-    clear(node->left);
-    clear(node->right);
-    delete node;
-  }
-}
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::clear() {
-  clear(root_);
-  root_ = nullptr;
-  size = 0;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+size_t s21::Map<key_type, mapped_type, Compare, Alloc>::Size() {
+  return tree_.size();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::const_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::begin() const {
+  return tree_.begin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::begin() {
+  return tree_.begin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::const_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::end() const {
+  return tree_.end();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::end() {
+  return tree_.end();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline
+    typename s21::Map<key_type, mapped_type, Compare, Alloc>::reverse_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::rbegin() {
+  return tree_.rbegin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare,
+                         Alloc>::const_reverse_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::rbegin() const {
+  return tree_.rbegin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline
+    typename s21::Map<key_type, mapped_type, Compare, Alloc>::reverse_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::rend() {
+  return tree_.rend();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare,
+                         Alloc>::const_reverse_iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::rend() const {
+  return tree_.rend();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::reference
+s21::Map<key_type, mapped_type, Compare, Alloc>::front() {
+  return *tree_.begin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline
+    typename s21::Map<key_type, mapped_type, Compare, Alloc>::const_reference
+s21::Map<key_type, mapped_type, Compare, Alloc>::front() const {
+  return *tree_.begin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline typename s21::Map<key_type, mapped_type, Compare, Alloc>::reference
+s21::Map<key_type, mapped_type, Compare, Alloc>::back() {
+  return *tree_.rbegin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline
+    typename s21::Map<key_type, mapped_type, Compare, Alloc>::const_reference
+s21::Map<key_type, mapped_type, Compare, Alloc>::back() const {
+  return *tree_.rbegin();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline void s21::Map<key_type, mapped_type, Compare, Alloc>::clear() {
+  tree_.clear();
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+std::pair<typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator,
+          bool>
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert(
+    const value_type &value) {
+  return tree_.insert_unique(value);
 }
 
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::insert(Node<value_type> *&node,
-                                                    value_type const &item,
-                                                    Node<value_type> *parent) {
-  if (!node) {
-    node = new Node<value_type>(item, nullptr, nullptr, parent);
-  } else if (item.first < node->data.first) {
-    insert(node->left, item, node);
-  } else if (node->data.first < item.first) {
-    insert(node->right, item, node);
-  } else {
-    node->data.second = item.second;
-  }
-  size++;
-}
-template <typename key_type, typename mapped_type>
-typename std::pair<typename s21::Map<key_type, mapped_type>::iterator, bool>
-s21::Map<key_type, mapped_type>::insert(const value_type &value) {
-  Node<value_type> **cur = &root_;
-  Node<value_type> *parent = nullptr;
-  while (*cur) {
-    if (value.first < (*cur)->data.first) {
-      parent = *cur;
-      cur = &(*cur)->left;
-    } else if ((*cur)->data.first < value.first) {
-      parent = *cur;
-      cur = &(*cur)->right;
-    } else {
-      // false
-      return std::make_pair(iterator(*cur), false);
-    }
-  }
-  *cur = new Node<value_type>(value, nullptr, nullptr, parent);
-  ++size;
-  return std::make_pair(iterator(*cur), true);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+std::pair<typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator,
+          bool>
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert(key_type const &key,
+                                               mapped_type const &obj) {
+  return tree_.insert_unique(value_type(key, obj));
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert(const_iterator hint,
+                                               const value_type &value) {
+  return tree_.insert_unique(hint, value);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+template <typename ForwardIt>
+void s21::Map<key_type, mapped_type, Compare, Alloc>::assign_sorted(
+    ForwardIt first, ForwardIt last) {
+  tree_.assign_sorted(first, last, true);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+std::pair<typename s21::Map<key_type, mapped_type, Compare, Alloc>::iterator,
+          bool>
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert_or_assign(
+    key_type const &key, mapped_type const &obj) {
+  auto result = tree_.insert_unique(value_type(key, obj));
+  if (!result.second) (*result.first).second = obj;
+  return result;
 }
-
-template <typename key_type, typename mapped_type>
-typename std::pair<typename s21::Map<key_type, mapped_type>::iterator, bool>
-s21::Map<key_type, mapped_type>::insert(key_type const &key,
-                                        mapped_type const &obj) {
-  Node<value_type> **cur = &root_;
-  Node<value_type> *parent = nullptr;
-  while (*cur) {
-    if (key < (*cur)->data.first) {
-      parent = *cur;
-      cur = &(*cur)->left;
-    } else if ((*cur)->data.first < key) {
-      parent = *cur;
-      cur = &(*cur)->right;
-    } else {
-      // the key already exists
-      return std::make_pair(iterator(*cur), false);
-    }
-  }
-  *cur = new Node<value_type>(value_type(key, obj), nullptr, nullptr, parent);
-  ++size;
-  return std::make_pair(iterator(*cur), true);
-}
-template <typename key_type, typename mapped_type>
-typename std::pair<typename s21::Map<key_type, mapped_type>::iterator, bool>
-s21::Map<key_type, mapped_type>::insert_or_assign(key_type const &key,
-                                                  mapped_type const &obj) {
-  Node<value_type> **cur = &root_;
-  Node<value_type> *parent = nullptr;
-  while (*cur) {
-    if (key < (*cur)->data.first) {
-      parent = *cur;
-      cur = &(*cur)->left;
-    } else if ((*cur)->data.first < key) {
-      parent = *cur;
-      cur = &(*cur)->right;
-    } else {
-      (*cur)->data.second = obj;
-      return std::make_pair(iterator(*cur), false);
-    }
-  }
-  *cur = new Node<value_type>(value_type(key, obj), nullptr, nullptr, parent);
-  ++size;
-  return std::make_pair(iterator(*cur), true);
-}
-template <typename key_type, typename mapped_type>
-typename Map<key_type, mapped_type>::mapped_type &
-Map<key_type, mapped_type>::at(const key_type &key) {
-  Node<value_type> *node = find_node(root_, key);
-  if (node) {
-    return node->data.second;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::mapped_type &
+Map<key_type, mapped_type, Compare, Alloc>::at(const key_type &key) {
+  auto it = tree_.find(key);
+  if (it != tree_.end()) {
+    return (*it).second;
   } else {
     throw std::out_of_range("Key not found");
   }
 }
-template <typename key_type, typename mapped_type>
-typename Map<key_type, mapped_type>::mapped_type &
-Map<key_type, mapped_type>::operator[](const key_type &key) {
-  Node<value_type> *current_ = root_;
-  Node<value_type> *parent = nullptr;
-  while (current_ != nullptr) {
-    if (key == current_->data.first) {
-      return current_->data.second;
-    } else if (key < current_->data.first) {
-      parent = current_;
-      current_ = current_->left;
-    } else {
-      parent = current_;
-      current_ = current_->right;
-    }
-  }
-  Node<value_type> *newNode = new Node<value_type>(
-      std::make_pair(key, mapped_type()), nullptr, nullptr, parent);
-  if (parent == nullptr) {
-    root_ = newNode;
-  } else if (key < parent->data.first) {
-    parent->left = newNode;
-  } else {
-    parent->right = newNode;
-  }
-  return newNode->data.second;
-}
-template <typename key_type, typename mapped_type>
-typename s21::Map<key_type, mapped_type>::template Node<
-    std::pair<const key_type, mapped_type>>
-    *s21::Map<key_type, mapped_type>::find_node(Node<value_type> *node,
-                                                const key_type &key) const {
-  if (node == nullptr) {
-    return nullptr;
-  } else if (key < node->data.first) {
-    return find_node(node->left, key);
-  } else if (key > node->data.first) {
-    return find_node(node->right, key);
-  } else {
-    return node;
-  }
-}
-
-template <typename key_type, typename mapped_type>
-typename Map<key_type, mapped_type>::mapped_type const *
-Map<key_type, mapped_type>::find(Node<value_type> *node,
-                                 key_type const &key) const {
-  if (!node) {
-    return nullptr;
-  } else if (key < node->data.first) {
-    return find(node->left, key);
-  } else if (node->data.first < key) {
-    return find(node->right, key);
-  } else {
-    return &(node->data.second);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::mapped_type &
+Map<key_type, mapped_type, Compare, Alloc>::operator[](const key_type &key) {
+  // one descent: a missing key goes right before its lower bound
+  auto it = tree_.lower_bound(key);
+  if (it == tree_.end() || tree_.key_comp()(key, (*it).first)) {
+    it = tree_.insert_unique(it, value_type(key, mapped_type()));
   }
+  return (*it).second;
 }
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::swap(Map &other) {
-  std::swap(root_, other.root_);
-  std::swap(size, other.size);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline void s21::Map<key_type, mapped_type, Compare, Alloc>::swap(Map &other) {
+  tree_.swap(other.tree_);
 }
 
-template <typename key_type, typename mapped_type>
-bool s21::Map<key_type, mapped_type>::contains(const key_type &key) const {
-  Node<value_type> *current_ = root_;
-  while (current_ != nullptr) {
-    if (key == current_->data.first) {
-      return true;
-    } else if (key < current_->data.first) {
-      current_ = current_->left;
-    } else {
-      current_ = current_->right;
-    }
-  }
-  return false;
-}
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::merge(Map &other) {
-  for (auto const &item : other) {
-    insert(item);
-    // other.clear();
-  }
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+bool s21::Map<key_type, mapped_type, Compare, Alloc>::contains(
+    const key_type &key) const {
+  return tree_.contains(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::iterator
+Map<key_type, mapped_type, Compare, Alloc>::lower_bound(const key_type &key) {
+  return tree_.lower_bound(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::const_iterator
+Map<key_type, mapped_type, Compare, Alloc>::lower_bound(
+    const key_type &key) const {
+  return tree_.lower_bound(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::iterator
+Map<key_type, mapped_type, Compare, Alloc>::upper_bound(const key_type &key) {
+  return tree_.upper_bound(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename Map<key_type, mapped_type, Compare, Alloc>::const_iterator
+Map<key_type, mapped_type, Compare, Alloc>::upper_bound(
+    const key_type &key) const {
+  return tree_.upper_bound(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+std::pair<typename Map<key_type, mapped_type, Compare, Alloc>::iterator,
+          typename Map<key_type, mapped_type, Compare, Alloc>::iterator>
+Map<key_type, mapped_type, Compare, Alloc>::equal_range(const key_type &key) {
+  return tree_.equal_range(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+std::pair<typename Map<key_type, mapped_type, Compare, Alloc>::const_iterator,
+          typename Map<key_type, mapped_type, Compare, Alloc>::const_iterator>
+Map<key_type, mapped_type, Compare, Alloc>::equal_range(
+    const key_type &key) const {
+  return tree_.equal_range(key);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+s21::TreeDebugStats
+s21::Map<key_type, mapped_type, Compare, Alloc>::debug_stats() const {
+  return tree_.debug_stats();
 }
 
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::erase(iterator pos) {
-  Node<value_type> *node = pos.current_;
-  if (!node) {
-    return;
-  }
-  if (!node->left && !node->right) {  // если удаляемый узел не имеет потомков
-    if (node == root_) {
-      root_ = nullptr;
-    } else {
-      if (node->parent->left == node) {
-        node->parent->left = nullptr;
-      } else {
-        node->parent->right = nullptr;
-      }
-    }
-  } else if (!node->left) {
-    transplant(node, node->right);
-  } else if (!node->right) {
-    transplant(node, node->left);
-  } else {
-    Node<value_type> *min_right = minimum(node->right);
-    if (min_right->parent != node) {
-      transplant(min_right, min_right->right);
-      min_right->right = node->right;
-      min_right->right->parent = min_right;
-    }
-    transplant(node, min_right);
-    min_right->left = node->left;
-    min_right->left->parent = min_right;
-  }
-  delete node;
-  size--;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+double s21::Map<key_type, mapped_type, Compare, Alloc>::sampled_depth(
+    size_type samples) const {
+  return tree_.sampled_depth(samples);
 }
 
-template <typename key_type, typename mapped_type>
-inline void s21::Map<key_type, mapped_type>::transplant(Node<value_type> *u,
-                                                        Node<value_type> *v) {
-  if (!u->parent) {
-    root_ = v;
-  } else if (u == u->parent->left) {
-    u->parent->left = v;
-  } else {
-    u->parent->right = v;
-  }
-  if (v) {
-    v->parent = u->parent;
-  }
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline void s21::Map<key_type, mapped_type, Compare, Alloc>::merge(Map &other) {
+  // keys already present stay behind in other, as with std::map
+  tree_.merge_unique(other.tree_);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename s21::Map<key_type, mapped_type, Compare, Alloc>::insert_return_type
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert(node_type &&nh) {
+  return tree_.insert_unique(std::move(nh));
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename s21::Map<key_type, mapped_type, Compare, Alloc>::node_type
+s21::Map<key_type, mapped_type, Compare, Alloc>::extract(const_iterator pos) {
+  return tree_.extract(pos);
+}
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+typename s21::Map<key_type, mapped_type, Compare, Alloc>::node_type
+s21::Map<key_type, mapped_type, Compare, Alloc>::extract(const key_type &key) {
+  return tree_.extract(key);
 }
-template <typename key_type, typename mapped_type>
-typename s21::Map<key_type, mapped_type>::template Node<
-    std::pair<const key_type, mapped_type>>
-    *s21::Map<key_type, mapped_type>::minimum(Node<value_type> *x) const {
-  while (x->left) {
-    x = x->left;
-  }
-  return x;
-}
-template <typename key_type, typename mapped_type>
-typename s21::Map<key_type, mapped_type>::template Node<
-    std::pair<const key_type, mapped_type>>
-    *s21::Map<key_type, mapped_type>::successor(Node<value_type> *x) const {
-  if (x->right) {
-    return minimum(x->right);
-  }
-  Node<value_type> *y = x->parent;
-  while (y && x == y->right) {
-    x = y;
-    y = y->parent;
-  }
-  return y;
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
+inline void s21::Map<key_type, mapped_type, Compare, Alloc>::erase(
+    iterator pos) {
+  tree_.erase(pos);
 }
-template <typename key_type, typename mapped_type>
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename Alloc>
 template <typename... Args>
-s21::Vector<std::pair<typename Map<key_type, mapped_type>::iterator, bool>>
-s21::Map<key_type, mapped_type>::insert_many(Args &&...args) {
+s21::Vector<std::pair<
+    typename Map<key_type, mapped_type, Compare, Alloc>::iterator, bool>>
+s21::Map<key_type, mapped_type, Compare, Alloc>::insert_many(Args &&...args) {
   s21::Vector<std::pair<iterator, bool>> result = {(insert(args))...};
   return result;
 }
+
+namespace pmr {
+template <typename Key, typename T>
+using Map =
+    s21::Map<Key, T, std::less<Key>,
+             std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // SRC_S21_CONTAINERS_MAP_H_
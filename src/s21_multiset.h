@@ -1,247 +1,64 @@
 #ifndef SRC_S21_MULTISET_H_
 #define SRC_S21_MULTISET_H_
 #include "s21_helpsrc.h"
+#include "s21_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Compare = std::less<T>,
+          typename Alloc = std::allocator<T>>
 class Multiset {
+  using tree_type = Tree<T, T, KeyIdentity<T>, Compare, Alloc>;
+  static constexpr bool kNothrowMoveAssign =
+      std::is_nothrow_move_assignable_v<tree_type>;
+  template <typename Q, typename R>
+  using if_transparent = typename tree_type::template if_transparent<Q, R>;
+
  public:
   using key_type = T;
   using value_type = T;
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Alloc;
 
-  struct Node {
-    value_type value;
-    Node *parent;
-    Node *left;
-    Node *right;
-
-    Node(const value_type &value)
-        : value(value), parent(nullptr), left(nullptr), right(nullptr) {}
-    ~Node() = default;
-  };
-
-  class MultisetIterator {
-   public:
-    using iterator = MultisetIterator;
-    using value_type = T;
-    using reference = const T &;
-    using pointer = const T *;
-    using difference_type = std::ptrdiff_t;
-    using iterator_category = std::bidirectional_iterator_tag;
-
-    // explicit MultisetIterator(Node *node, const Multiset<T> *multiset) :
-    // m_node_(node), m_multiset(multiset) {} MultisetIterator(Node* node, const
-    // Multiset<T>* multiset = nullptr) : m_node_(node), m_multiset(multiset) {}
-    // MultisetIterator(Node* node) : m_node__(node)
-    MultisetIterator(Node *node = nullptr,
-                     const Multiset<T> *multiset = nullptr)
-        : m_node_(node), m_multiset(multiset){};
-    ~MultisetIterator() = default;
-
-    MultisetIterator &operator++() {
-      m_node_ = get_successor(m_node_);
-      return *this;
-    }
-
-    MultisetIterator operator++(int) {
-      MultisetIterator temp(*this);
-      ++(*this);
-      return temp;
-    }
-
-    MultisetIterator &operator--() {
-      if (m_node_ == nullptr) {
-        m_node_ = get_maximum(m_multiset->m_root_);
-      } else {
-        m_node_ = get_predecessor(m_node_);
-      }
-      return *this;
-    }
-
-    MultisetIterator operator--(int) {
-      MultisetIterator temp(*this);
-      --(*this);
-      return temp;
-    }
-
-    bool operator==(const MultisetIterator &other) const {
-      return m_node_ == other.m_node_;
-    }
-
-    bool operator!=(const MultisetIterator &other) const {
-      return !(*this == other);
-    }
-
-    reference operator*() const { return m_node_->value; }
-
-    pointer operator->() const { return &m_node_->value; }
-
-   private:
-    Node *m_node_;
-    const Multiset<value_type> *m_multiset;
-
-    Node *multiset_minimum(Node *node) const {
-      if (node == nullptr) {
-        return nullptr;
-      }
-      if (node->left == nullptr) {
-        return node;
-      }
-      return multiset_minimum(node->left);
-    }
-
-    Node *get_successor(Node *node) const {
-      if (node == nullptr) {
-        return nullptr;
-      }
-      if (node->right != nullptr) {
-        return multiset_minimum(node->right);
-      }
-      Node *parent = node->parent;
-      while (parent != nullptr && node == parent->right) {
-        node = parent;
-        parent = parent->parent;
-      }
-      return parent;
-    }
-
-    Node *get_predecessor(Node *node) const {
-      if (node == nullptr) {
-        return multiset_maximum(m_multiset->m_root_);
-      }
-      if (node->left != nullptr) {
-        return multiset_maximum(node->left);
-      }
-      Node *parent = node->parent;
-      while (parent != nullptr && node == parent->left) {
-        node = parent;
-        parent = parent->parent;
-      }
-      return parent;
-    }
-  };
-
-  class ConstMultisetIterator {
-   public:
-    using value_type = T;
-    using reference = const T &;
-    using pointer = const T *;
-    using difference_type = std::ptrdiff_t;
-    using iterator_category = std::bidirectional_iterator_tag;
-
-    explicit ConstMultisetIterator(
-        const typename Multiset<value_type>::Node *node,
-        const Multiset<value_type> *multiset)
-        : m_node_(node), m_multiset(multiset) {}
-
-    ConstMultisetIterator &operator++() {
-      m_node_ = get_successor(m_node_);
-      return *this;
-    }
-
-    ConstMultisetIterator operator++(int) {
-      ConstMultisetIterator temp(*this);
-      ++(*this);
-      return temp;
-    }
-
-    ConstMultisetIterator &operator--() {
-      if (m_node_ == nullptr) {
-        m_node_ = get_maximum(m_multiset->m_root_);
-      } else {
-        m_node_ = get_predecessor(m_node_);
-      }
-      return *this;
-    }
-
-    ConstMultisetIterator operator--(int) {
-      ConstMultisetIterator temp(*this);
-      --(*this);
-      return temp;
-    }
-
-    bool operator==(const ConstMultisetIterator &other) const {
-      return m_node_ == other.m_node_;
-    }
-
-    bool operator!=(const ConstMultisetIterator &other) const {
-      return !(*this == other);
-    }
-
-    reference operator*() { return m_node_->value; }
-
-    pointer operator->() { return &m_node_->value; }
-
-   private:
-    const typename Multiset<value_type>::Node *m_node_;
-    const Multiset<value_type> *m_multiset;
-
-    Node *multiset_minimum(Node *node) const {
-      if (node == nullptr) {
-        return nullptr;
-      }
-      if (node->left == nullptr) {
-        return node;
-      }
-      return multiset_minimum(node->left);
-    }
-
-    const typename Multiset<value_type>::Node *get_successor(
-        const typename Multiset<value_type>::Node *node) const {
-      if (node == nullptr) {
-        return nullptr;
-      }
-      if (node->right != nullptr) {
-        return multiset_minimum(node->right);
-      }
-      const typename Multiset<value_type>::Node *parent = node->parent;
-      while (parent != nullptr && node == parent->right) {
-        node = parent;
-        parent = parent->parent;
-      }
-      return parent;
-    }
-
-    const typename Multiset<value_type>::Node *get_predecessor(
-        const typename Multiset<value_type>::Node *node) const {
-      if (node == nullptr) {
-        return nullptr;
-      }
-      if (node->left != nullptr) {
-        return multiset_maximum(node->left);
-      }
-      const typename Multiset<T>::Node *parent = node->parent;
-      while (parent != nullptr && node == parent->left) {
-        node = parent;
-        parent = parent->parent;
-      }
-      return parent;
-    }
-  };
-
+  using Node = typename tree_type::Node;
+  using MultisetIterator = typename tree_type::iterator;
+  using ConstMultisetIterator = typename tree_type::const_iterator;
   using iterator = MultisetIterator;
   using const_iterator = ConstMultisetIterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+  using node_type = typename tree_type::node_type;
 
   Multiset();  // default constructor, creates empty set
-  Multiset(std::initializer_list<value_type> const
-               &items);          // initializer list constructor
-  Multiset(const Multiset &ms);  // copy constructor
-  Multiset(Multiset &&ms);       // move constructor
-  ~Multiset();                   // destructor
-
-  Multiset<value_type> &operator=(
-      Multiset<value_type>
-          &&ms) noexcept;  // assignment operator overload for moving object
+  explicit Multiset(const allocator_type &alloc);  // empty, nodes from alloc
+  explicit Multiset(const key_compare &comp,
+                    const allocator_type &alloc = allocator_type());
+  Multiset(std::initializer_list<value_type> const &items,
+           const allocator_type &alloc =
+               allocator_type());  // initializer list constructor
+  Multiset(const Multiset &ms);    // copy constructor
+  Multiset(Multiset &&ms);         // move constructor
+  ~Multiset();                     // destructor
+
+  // assignment operator overload for moving object
+  Multiset &operator=(Multiset &&ms) noexcept(kNothrowMoveAssign);
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
 
   // Итераторы
   iterator begin();
   const_iterator begin() const;
   iterator end();
   const_iterator end() const;
+  reverse_iterator rbegin();  // the largest element first, in O(1)
+  const_reverse_iterator rbegin() const;
+  reverse_iterator rend();
+  const_reverse_iterator rend() const;
+  const_reference front() const;  // the smallest element, in O(1)
+  const_reference back() const;   // the largest element, in O(1)
 
   bool empty();          // checks whether the container is empty
   size_type size();      // returns the number of elements
@@ -249,6 +66,9 @@ class Multiset {
 
   // Модификаторы
   iterator insert(const value_type &value);
+  iterator insert(node_type &&nh);  // links an extracted node, no allocation
+  node_type extract(const_iterator pos);   // unlinks the node at pos
+  node_type extract(const key_type &key);  // unlinks one node with key
   void clear();
   void swap(Multiset &other);
 
@@ -265,11 +85,43 @@ class Multiset {
       const key_type
           &key);  // returns range of elements matching a specific key
   iterator lower_bound(
-      const key_type &key);  // returns an iterator to the first element not
-                             // less than the given key
+      const key_type &key);  // returns an iterator to the first element not
+                             // less than the given key
   iterator upper_bound(
       const key_type &key);  // returns an iterator to the first
-                             // element greater than the given key
+                             // element greater than the given key
+  // lookups by any key type a transparent Compare such as std::less<> takes
+  template <typename Q>
+  if_transparent<Q, size_type> count(const Q &key) {
+    return m_tree_.count(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> find(const Q &key) {
+    return m_tree_.find(key);
+  }
+  template <typename Q>
+  if_transparent<Q, bool> contains(const Q &key) {
+    return m_tree_.contains(key);
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<iterator, iterator>> equal_range(const Q &key) {
+    return m_tree_.equal_range(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> lower_bound(const Q &key) {
+    return m_tree_.lower_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> upper_bound(const Q &key) {
+    return m_tree_.upper_bound(key);
+  }
+
+  iterator nth(size_type k);  // k-th element in order, end() if k >= size
+  size_type rank(const key_type &key) const;  // number of elements < key
+  size_type count_range(const key_type &lo,
+                        const key_type &hi) const;  // elements in [lo, hi)
+  TreeDebugStats debug_stats() const;  // height and depths, visits every node
+  double sampled_depth(size_type samples = 64) const;  // estimated avg depth
 
   template <typename... Args>
   Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
@@ -277,223 +129,254 @@ class Multiset {
   void print() const;
 
  private:
-  Node *m_root_;
-  size_type m_size_;
-  Node *get_minimum(Node *node) const;
-  void erase(iterator it, Node *node);
-  void delete_subtree(Node *node);
+  tree_type m_tree_;
   std::pair<iterator, bool> insert_emplace(const key_type &key);
-  void print_tree(Node *node) const;
 };
 
 //--------------------------------------------------------------------
 // Implementation
 //--------------------------------------------------------------------
 
-template <typename value_type>
-Multiset<value_type>::Multiset() : m_root_(nullptr), m_size_(0) {}
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset() : m_tree_() {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset(const allocator_type &alloc)
+    : m_tree_(alloc) {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset(const key_compare &comp,
+                                               const allocator_type &alloc)
+    : m_tree_(comp, alloc) {}
 
-template <typename value_type>
-Multiset<value_type>::Multiset(std::initializer_list<value_type> const &items)
-    : Multiset() {
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset(
+    std::initializer_list<value_type> const &items, const allocator_type &alloc)
+    : Multiset(alloc) {
   if (items.size() > max_size()) throw std::bad_alloc();
   for (const auto &item : items) {
     insert(item);
   }
 }
 
-template <typename value_type>
-Multiset<value_type>::Multiset(const Multiset &ms) : Multiset() {
-  for (const auto &item : ms) {
-    insert(item);
-  }
-}
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset(const Multiset &ms)
+    : m_tree_(ms.m_tree_) {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::Multiset(Multiset &&ms)
+    : m_tree_(std::move(ms.m_tree_)) {}
 
-template <typename value_type>
-Multiset<value_type>::Multiset(Multiset &&ms) : Multiset() {
-  swap(ms);
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc>::~Multiset() = default;
+
+template <typename value_type, typename Compare, typename Alloc>
+Multiset<value_type, Compare, Alloc> &
+Multiset<value_type, Compare, Alloc>::operator=(Multiset &&ms) noexcept(
+    kNothrowMoveAssign) {
+  m_tree_ = std::move(ms.m_tree_);
+  return *this;
 }
 
-template <typename value_type>
-Multiset<value_type>::~Multiset() {
-  delete_subtree(m_root_);
+template <typename value_type, typename Compare, typename Alloc>
+Alloc Multiset<value_type, Compare, Alloc>::get_allocator() const {
+  return m_tree_.get_allocator();
 }
 
-template <typename value_type>
-Multiset<value_type> &Multiset<value_type>::operator=(
-    Multiset<value_type> &&ms) noexcept {
-  if (this != &ms) {
-    clear();
-    swap(ms);
-  }
-  return *this;
+template <typename value_type, typename Compare, typename Alloc>
+Compare Multiset<value_type, Compare, Alloc>::key_comp() const {
+  return m_tree_.key_comp();
 }
 
-template <typename value_type>
-typename Multiset<value_type>::iterator Multiset<value_type>::begin() {
-  return iterator(get_minimum(m_root_), this);
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::iterator
+Multiset<value_type, Compare, Alloc>::begin() {
+  return m_tree_.begin();
 }
 
-template <typename value_type>
-typename Multiset<value_type>::const_iterator Multiset<value_type>::begin()
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_iterator
+Multiset<value_type, Compare, Alloc>::begin()
     const {
-  return const_iterator(get_minimum(m_root_), this);
+  return m_tree_.begin();
 }
 
-template <typename value_type>
-typename Multiset<value_type>::iterator Multiset<value_type>::end() {
-  return iterator(nullptr, this);
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::iterator
+Multiset<value_type, Compare, Alloc>::end() {
+  return m_tree_.end();
 }
 
-template <typename value_type>
-typename Multiset<value_type>::const_iterator Multiset<value_type>::end()
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_iterator
+Multiset<value_type, Compare, Alloc>::end()
     const {
-  return const_iterator(nullptr, this);
+  return m_tree_.end();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::reverse_iterator
+Multiset<value_type, Compare, Alloc>::rbegin() {
+  return m_tree_.rbegin();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_reverse_iterator
+Multiset<value_type, Compare, Alloc>::rbegin() const {
+  return m_tree_.rbegin();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::reverse_iterator
+Multiset<value_type, Compare, Alloc>::rend() {
+  return m_tree_.rend();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_reverse_iterator
+Multiset<value_type, Compare, Alloc>::rend() const {
+  return m_tree_.rend();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_reference
+Multiset<value_type, Compare, Alloc>::front() const {
+  return *m_tree_.begin();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::const_reference
+Multiset<value_type, Compare, Alloc>::back() const {
+  return *m_tree_.rbegin();
 }
 
-template <typename value_type>
-bool Multiset<value_type>::empty() {
-  return (m_size_ == 0);
+template <typename value_type, typename Compare, typename Alloc>
+bool Multiset<value_type, Compare, Alloc>::empty() {
+  return m_tree_.empty();
 }
 
-template <typename value_type>
-size_t Multiset<value_type>::size() {
-  return m_size_;
+template <typename value_type, typename Compare, typename Alloc>
+size_t Multiset<value_type, Compare, Alloc>::size() {
+  return m_tree_.size();
 }
 
-template <typename value_type>
-size_t Multiset<value_type>::max_size() {
+template <typename value_type, typename Compare, typename Alloc>
+size_t Multiset<value_type, Compare, Alloc>::max_size() {
   return SIZE_MAX / sizeof(value_type);
 }
 
-template <typename value_type>
-typename Multiset<value_type>::iterator Multiset<value_type>::insert(
-    const value_type &value) {
-  Node *node = m_root_;
-  Node *parent = nullptr;
-  while (node != nullptr) {
-    parent = node;
-    if (value <= node->value) {
-      node = node->left;
-    } else {
-      node = node->right;
-    }
-  }
-  Node *new_node = new Node(value);
-  new_node->parent = parent;
-  if (parent == nullptr) {
-    m_root_ = new_node;
-  } else if (value <= parent->value) {
-    parent->left = new_node;
-  } else {
-    parent->right = new_node;
-  }
-  ++m_size_;
-  return iterator(new_node, this);
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::iterator
+Multiset<value_type, Compare, Alloc>::insert(const value_type &value) {
+  return m_tree_.insert_equal(value);
 }
 
-template <typename value_type>
-void Multiset<value_type>::clear() {
-  delete_subtree(m_root_);
-  m_root_ = nullptr;
-  m_size_ = 0;
+template <typename value_type, typename Compare, typename Alloc>
+void Multiset<value_type, Compare, Alloc>::clear() {
+  m_tree_.clear();
 }
 
-template <typename value_type>
-void Multiset<value_type>::swap(Multiset &other) {
-  Node *tmp_root = m_root_;
-  size_t tmp_size = m_size_;
-  this->m_root_ = other.m_root_;
-  other.m_root_ = tmp_root;
-  this->m_size_ = other.m_size_;
-  other.m_size_ = tmp_size;
+template <typename value_type, typename Compare, typename Alloc>
+void Multiset<value_type, Compare, Alloc>::swap(Multiset &other) {
+  m_tree_.swap(other.m_tree_);
 }
 
-template <typename value_type>
-void s21::Multiset<value_type>::erase(iterator it) {
-  erase(it, m_root_);
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Multiset<value_type, Compare, Alloc>::erase(iterator it) {
+  m_tree_.erase(it);
 }
 
-template <typename value_type>
-void s21::Multiset<value_type>::merge(Multiset &other) {
-  if (this->m_root_ == other.m_root_) return;
-  auto it = other.begin();
-  for (size_t i = 0; i < other.m_size_; ++i) {
-    this->insert(*it);
-    ++it;
-  }
-  other.clear();
-}
-
-template <typename key_type>
-size_t Multiset<key_type>::count(const key_type &key) {
-  size_type count = 0;
-  Node *node = m_root_;
-  while (node) {
-    if (key < node->value) {
-      node = node->left;
-    } else if (node->value < key) {
-      node = node->right;
-    } else {
-      ++count;
-      node = node->left;
-    }
-  }
-  return count;
-}
-
-template <typename key_type>
-typename Multiset<key_type>::iterator Multiset<key_type>::find(
-    const key_type &key) {
-  Node *current = m_root_;
-  while (current != nullptr) {
-    if (key < current->value) {
-      current = current->left;
-    } else if (key > current->value) {
-      current = current->right;
-    } else {
-      return iterator(current, nullptr);
-    }
-  }
-  return end();
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Multiset<value_type, Compare, Alloc>::merge(Multiset &other) {
+  if (this == &other) return;
+  m_tree_.merge_equal(other.m_tree_);
 }
 
-template <typename key_type>
-bool Multiset<key_type>::contains(const key_type &key) {
-  return (find(key) != end());
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::iterator
+Multiset<value_type, Compare, Alloc>::insert(node_type &&nh) {
+  return m_tree_.insert_equal(std::move(nh));
 }
 
-template <typename key_type>
-std::pair<typename Multiset<key_type>::iterator,
-          typename Multiset<key_type>::iterator>
-Multiset<key_type>::equal_range(const key_type &key) {
-  return {this->lower_bound(key), this->upper_bound(key)};
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::node_type
+Multiset<value_type, Compare, Alloc>::extract(const_iterator pos) {
+  return m_tree_.extract(pos);
 }
 
-template <typename key_type>
-typename Multiset<key_type>::iterator Multiset<key_type>::lower_bound(
-    const key_type &key) {
-  auto it = begin();
-  while (it != end() && (*it < key)) {
-    ++it;
-  }
-  return it;
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::node_type
+Multiset<value_type, Compare, Alloc>::extract(const key_type &key) {
+  return m_tree_.extract(key);
 }
 
-template <typename key_type>
-typename Multiset<key_type>::iterator Multiset<key_type>::upper_bound(
-    const key_type &key) {
-  auto it = begin();
-  while (it != end() && !(key < *it)) {
-    ++it;
-  }
-  return it;
+template <typename key_type, typename Compare, typename Alloc>
+size_t Multiset<key_type, Compare, Alloc>::count(const key_type &key) {
+  return m_tree_.count(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+typename Multiset<key_type, Compare, Alloc>::iterator
+Multiset<key_type, Compare, Alloc>::find(const key_type &key) {
+  return m_tree_.find(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+bool Multiset<key_type, Compare, Alloc>::contains(const key_type &key) {
+  return m_tree_.contains(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+std::pair<typename Multiset<key_type, Compare, Alloc>::iterator,
+          typename Multiset<key_type, Compare, Alloc>::iterator>
+Multiset<key_type, Compare, Alloc>::equal_range(const key_type &key) {
+  return m_tree_.equal_range(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+typename Multiset<key_type, Compare, Alloc>::iterator
+Multiset<key_type, Compare, Alloc>::lower_bound(const key_type &key) {
+  return m_tree_.lower_bound(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+typename Multiset<key_type, Compare, Alloc>::iterator
+Multiset<key_type, Compare, Alloc>::upper_bound(const key_type &key) {
+  return m_tree_.upper_bound(key);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Multiset<value_type, Compare, Alloc>::iterator
+Multiset<value_type, Compare, Alloc>::nth(size_type k) {
+  return m_tree_.nth(k);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+size_t Multiset<key_type, Compare, Alloc>::rank(const key_type &key) const {
+  return m_tree_.rank(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+size_t Multiset<key_type, Compare, Alloc>::count_range(const key_type &lo,
+                                              const key_type &hi) const {
+  return m_tree_.count_range(lo, hi);
 }
 
-template <typename key_type>
+template <typename key_type, typename Compare, typename Alloc>
+TreeDebugStats Multiset<key_type, Compare, Alloc>::debug_stats() const {
+  return m_tree_.debug_stats();
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+double Multiset<key_type, Compare, Alloc>::sampled_depth(
+    size_type samples) const {
+  return m_tree_.sampled_depth(samples);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
 template <typename... Args>
-Vector<std::pair<typename Multiset<key_type>::iterator, bool>>
-Multiset<key_type>::insert_many(Args &&...args) {
+Vector<std::pair<typename Multiset<key_type, Compare, Alloc>::iterator, bool>>
+Multiset<key_type, Compare, Alloc>::insert_many(Args &&...args) {
   Vector<std::pair<iterator, bool>> result = {
       (insert_emplace(std::forward<Args>(args)))...};
   return result;
@@ -502,97 +385,26 @@ Multiset<key_type>::insert_many(Args &&...args) {
 // Implementation private
 //--------------------------------------------------------------------
 
-template <typename value_type>
-typename Multiset<value_type>::Node *Multiset<value_type>::get_minimum(
-    Node *node) const {
-  while (node != nullptr && node->left != nullptr) {
-    node = node->left;
-  }
-  return node;
-}
-
-template <typename value_type>
-void Multiset<value_type>::delete_subtree(Node *node) {
-  if (node != nullptr) {
-    delete_subtree(node->left);
-    delete_subtree(node->right);
-    delete node;
-  }
-}
-
-template <typename value_type>
-void Multiset<value_type>::erase(iterator it, Node *node) {
-  if (!node) {
-    return;
-  }
-  if ((it != nullptr) and (*it < node->value)) {
-    erase(it, node->left);
-  } else if ((it != nullptr) and (*it > node->value)) {
-    erase(it, node->right);
-  } else {
-    if (!node->left && !node->right) {
-      if (node == m_root_) {
-        m_root_ = nullptr;
-      } else if (node == node->parent->left) {
-        node->parent->left = nullptr;
-      } else {
-        node->parent->right = nullptr;
-      }
-      delete node;
-      --m_size_;
-    } else if (node->left && node->right) {
-      Node *min_node = node->right;
-      while (min_node->left) {
-        min_node = min_node->left;
-      }
-      node->value = min_node->value;
-      erase(iterator(min_node), min_node);
-    } else {
-      Node *child = node->left ? node->left : node->right;
-      if (node == m_root_) {
-        m_root_ = child;
-        if (child) {
-          child->parent = nullptr;
-        }
-      } else if (node == node->parent->left) {
-        node->parent->left = child;
-        if (child) {
-          child->parent = node->parent;
-        }
-      } else {
-        node->parent->right = child;
-        if (child) {
-          child->parent = node->parent;
-        }
-      }
-      delete node;
-      --m_size_;
-    }
-  }
-}
-
-template <typename key_type>
-std::pair<typename Multiset<key_type>::iterator, bool>
-Multiset<key_type>::insert_emplace(const key_type &value) {
+template <typename key_type, typename Compare, typename Alloc>
+std::pair<typename Multiset<key_type, Compare, Alloc>::iterator, bool>
+Multiset<key_type, Compare, Alloc>::insert_emplace(const key_type &value) {
   auto result = insert(value);
   return std::pair<iterator, bool>(result, true);
 }
 
-template <typename value_type>
-void Multiset<value_type>::print_tree(Node *node) const {
-  if (node) {
-    print_tree(node->left);
-    std::cout << node->value << " ";
-    print_tree(node->right);
+template <typename value_type, typename Compare, typename Alloc>
+void Multiset<value_type, Compare, Alloc>::print() const {
+  for (auto it = begin(); it != end(); ++it) {
+    std::cout << *it << " ";
   }
-}
-
-template <typename value_type>
-void Multiset<value_type>::print() const {
-  print_tree(m_root_);
   std::cout << std::endl;
 }
 
+
+namespace pmr {
+template <typename T>
+using Multiset =
+    s21::Multiset<T, std::less<T>, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
-#endif  //
-SRC_S21_MULTISET_H_
\ No newline at end of file
+#endif  // SRC_S21_MULTISET_H_
@@ -0,0 +1,379 @@
+#ifndef SRC_S21_PARALLEL_H_
+#define SRC_S21_PARALLEL_H_
+
+#include <numeric>
+
+#include "s21_helpsrc.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+// Parallel versions of the std algorithms for random access ranges such as
+// those of s21::Vector and s21::Array. Each one splits the range with
+// ThreadPool::parallel_invoke down to pieces of a few thousand elements
+// and runs the sequential algorithm on the pieces; ranges shorter than
+// kSequentialCutoff never leave the calling thread.
+//
+// Every algorithm takes the pool as an optional first argument and uses a
+// pool with one worker per core, created on first use, otherwise.
+namespace parallel {
+inline constexpr size_t kSequentialCutoff = size_t{1} << 15;
+
+inline ThreadPool& default_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+namespace internal {
+inline constexpr size_t kMinGrain = size_t{1} << 12;
+
+// about eight pieces per runner, so a slow one can be made up by steals
+inline size_t grain(const ThreadPool& pool, size_t n) {
+  return std::max(kMinGrain, n / ((pool.thread_count() + 1) * 8));
+}
+
+// calls f(begin, end) on consecutive pieces of [begin, end), in parallel
+template <class F>
+void split(ThreadPool& pool, size_t begin, size_t end, size_t grain, F& f) {
+  if (end - begin <= grain) {
+    f(begin, end);
+    return;
+  }
+  size_t middle = begin + (end - begin) / 2;
+  pool.parallel_invoke([&] { split(pool, begin, middle, grain, f); },
+                       [&] { split(pool, middle, end, grain, f); });
+}
+
+template <class It, class T, class BinaryOp>
+T reduce(ThreadPool& pool, It first, It last, size_t grain, BinaryOp& op) {
+  if (static_cast<size_t>(last - first) <= grain) {
+    T result = *first;
+    for (++first; first != last; ++first) result = op(result, *first);
+    return result;
+  }
+  It middle = first + (last - first) / 2;
+  std::optional<T> left, right;
+  pool.parallel_invoke(
+      [&] { left.emplace(reduce<It, T>(pool, first, middle, grain, op)); },
+      [&] { right.emplace(reduce<It, T>(pool, middle, last, grain, op)); });
+  return op(std::move(*left), std::move(*right));
+}
+
+// std::partition with the range cut into blocks of grain elements. The
+// blocks are partitioned in parallel, then the rejected elements left of
+// the overall split point are swapped in parallel with the kept ones right
+// of it; those come in at most one run per block on either side.
+template <class It, class Predicate>
+It partition(ThreadPool& pool, It first, It last, size_t grain,
+             Predicate& pred) {
+  size_t n = last - first;
+  if (n <= grain) return std::partition(first, last, pred);
+  size_t blocks = (n + grain - 1) / grain;
+  std::unique_ptr<size_t[]> kept(new size_t[blocks]);
+  auto partition_blocks = [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; ++b) {
+      It from = first + b * grain;
+      It to = first + std::min(n, (b + 1) * grain);
+      kept[b] = std::partition(from, to, pred) - from;
+    }
+  };
+  split(pool, 0, blocks, 1, partition_blocks);
+  size_t middle = 0;
+  for (size_t b = 0; b < blocks; ++b) middle += kept[b];
+  // a run starts at begin and is numbered from offset among the misplaced
+  // elements of its side; both sides have as many
+  struct Run {
+    size_t begin;
+    size_t offset;
+  };
+  std::unique_ptr<Run[]> left(new Run[blocks]);
+  std::unique_ptr<Run[]> right(new Run[blocks]);
+  size_t left_runs = 0;
+  size_t right_runs = 0;
+  size_t misplaced = 0;
+  size_t right_misplaced = 0;
+  for (size_t b = 0; b < blocks; ++b) {
+    size_t begin = b * grain;
+    size_t end = std::min(n, begin + grain);
+    size_t boundary = begin + kept[b];
+    if (boundary < std::min(end, middle)) {
+      left[left_runs++] = {boundary, misplaced};
+      misplaced += std::min(end, middle) - boundary;
+    } else if (boundary > std::max(begin, middle)) {
+      right[right_runs++] = {std::max(begin, middle), right_misplaced};
+      right_misplaced += boundary - std::max(begin, middle);
+    }
+  }
+  auto run_of = [](const Run* runs, size_t count, size_t k) {
+    auto after = [](size_t k, const Run& run) { return k < run.offset; };
+    return std::upper_bound(runs, runs + count, k, after) - runs - 1;
+  };
+  auto swap_misplaced = [&](size_t begin, size_t end) {
+    if (begin == end) return;
+    size_t l = run_of(left.get(), left_runs, begin);
+    size_t r = run_of(right.get(), right_runs, begin);
+    for (size_t k = begin; k < end; ++k) {
+      if (l + 1 < left_runs && left[l + 1].offset == k) ++l;
+      if (r + 1 < right_runs && right[r + 1].offset == k) ++r;
+      std::iter_swap(first + (left[l].begin + k - left[l].offset),
+                     first + (right[r].begin + k - right[r].offset));
+    }
+  };
+  split(pool, 0, misplaced, grain, swap_misplaced);
+  return first + middle;
+}
+
+// Quicksort whose partitions and halves run in parallel. Keys equal to the
+// pivot are set apart in the middle, so repeated keys cannot unbalance it,
+// and after depth_left bad splits a piece goes to std::sort like introsort.
+// The pivot is never copied: like introsort, the median of three is
+// swapped to the front and compared against where it lies.
+template <class It, class Compare>
+void quicksort(ThreadPool& pool, It first, It last, size_t grain,
+               int depth_left, Compare& comp) {
+  if (static_cast<size_t>(last - first) <= grain || depth_left == 0) {
+    std::sort(first, last, comp);
+    return;
+  }
+  It middle = first + (last - first) / 2;
+  It back = last - 1;
+  // median of three
+  if (comp(*middle, *first)) std::iter_swap(middle, first);
+  if (comp(*back, *middle)) {
+    std::iter_swap(back, middle);
+    if (comp(*middle, *first)) std::iter_swap(middle, first);
+  }
+  std::iter_swap(first, middle);
+  auto below = [&](const auto& value) { return comp(value, *first); };
+  It less = partition(pool, first + 1, last, grain, below);
+  It pivot = less - 1;
+  std::iter_swap(first, pivot);
+  auto not_above = [&](const auto& value) {
+    return !comp(*pivot, value);
+  };
+  It greater = partition(pool, less, last, grain, not_above);
+  pool.parallel_invoke(
+      [&] { quicksort(pool, first, pivot, grain, depth_left - 1, comp); },
+      [&] { quicksort(pool, greater, last, grain, depth_left - 1, comp); });
+}
+
+// Merges the sorted runs [first1, last1) and [first2, last2) into out,
+// elements of the first run first among equal ones. The longer run is cut
+// in the middle and the other at the matching bound, so both halves merge
+// in parallel.
+template <class In, class Out, class Compare>
+void merge(ThreadPool& pool, In first1, In last1, In first2, In last2,
+           Out out, size_t grain, Compare& comp) {
+  size_t n1 = last1 - first1;
+  size_t n2 = last2 - first2;
+  if (n1 + n2 <= grain) {
+    std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+               std::make_move_iterator(first2), std::make_move_iterator(last2),
+               out, comp);
+    return;
+  }
+  In cut1;
+  In cut2;
+  if (n1 >= n2) {
+    cut1 = first1 + n1 / 2;
+    cut2 = std::lower_bound(first2, last2, *cut1, comp);
+  } else {
+    cut2 = first2 + n2 / 2;
+    cut1 = std::upper_bound(first1, last1, *cut2, comp);
+  }
+  Out out_middle = out + ((cut1 - first1) + (cut2 - first2));
+  pool.parallel_invoke(
+      [&] { merge(pool, first1, cut1, first2, cut2, out, grain, comp); },
+      [&] { merge(pool, cut1, last1, cut2, last2, out_middle, grain, comp); });
+}
+
+// Stable merge sort of the n elements at values that alternates between
+// values and spare level by level; into_spare says where this level leaves
+// the result.
+template <class It1, class It2, class Compare>
+void merge_sort(ThreadPool& pool, It1 values, It2 spare, size_t n,
+                size_t grain, bool into_spare, Compare& comp) {
+  if (n <= grain) {
+    std::stable_sort(values, values + n, comp);
+    if (into_spare) std::move(values, values + n, spare);
+    return;
+  }
+  size_t half = n / 2;
+  pool.parallel_invoke(
+      [&] {
+        merge_sort(pool, values, spare, half, grain, !into_spare, comp);
+      },
+      [&] {
+        merge_sort(pool, values + half, spare + half, n - half, grain,
+                   !into_spare, comp);
+      });
+  if (into_spare) {
+    merge(pool, values, values + half, values + half, values + n, spare,
+          grain, comp);
+  } else {
+    merge(pool, spare, spare + half, spare + half, spare + n, values, grain,
+          comp);
+  }
+}
+}  // namespace internal
+
+// f is called once for every element, from any thread
+template <class RandomIt, class UnaryFunction>
+void for_each(ThreadPool& pool, RandomIt first, RandomIt last,
+              UnaryFunction f) {
+  size_t n = last - first;
+  if (n < kSequentialCutoff) {
+    std::for_each(first, last, f);
+    return;
+  }
+  auto piece = [&](size_t begin, size_t end) {
+    std::for_each(first + begin, first + end, f);
+  };
+  internal::split(pool, 0, n, internal::grain(pool, n), piece);
+}
+template <class RandomIt, class UnaryFunction>
+void for_each(RandomIt first, RandomIt last, UnaryFunction f) {
+  for_each(default_pool(), first, last, f);
+}
+
+// [d_first, d_first + (last - first)) may be [first, last) itself
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform(ThreadPool& pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOperation op) {
+  size_t n = last - first;
+  if (n < kSequentialCutoff) return std::transform(first, last, d_first, op);
+  auto piece = [&](size_t begin, size_t end) {
+    std::transform(first + begin, first + end, d_first + begin, op);
+  };
+  internal::split(pool, 0, n, internal::grain(pool, n), piece);
+  return d_first + n;
+}
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   UnaryOperation op) {
+  return transform(default_pool(), first, last, d_first, op);
+}
+
+// op must be associative; unlike std::accumulate the elements are not
+// combined from left to right
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(ThreadPool& pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = BinaryOp()) {
+  size_t n = last - first;
+  if (n < kSequentialCutoff) {
+    return std::accumulate(first, last, std::move(init), op);
+  }
+  return op(std::move(init), internal::reduce<RandomIt, T>(
+                                 pool, first, last, internal::grain(pool, n),
+                                 op));
+}
+template <class RandomIt, class T, class BinaryOp = std::plus<>>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp()) {
+  return reduce(default_pool(), first, last, std::move(init), op);
+}
+
+// Two passes over blocks: the blocks are reduced in parallel, their totals
+// scanned in order, then each block is scanned starting from the total of
+// the blocks before it. op must be associative. d_first may be first.
+template <class RandomIt, class OutputIt, class BinaryOp = std::plus<>>
+OutputIt inclusive_scan(ThreadPool& pool, RandomIt first, RandomIt last,
+                        OutputIt d_first, BinaryOp op = BinaryOp()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t n = last - first;
+  if (n < kSequentialCutoff) {
+    return std::partial_sum(first, last, d_first, op);
+  }
+  size_t block = internal::grain(pool, n);
+  size_t blocks = (n + block - 1) / block;
+  std::unique_ptr<std::optional<T>[]> totals(new std::optional<T>[blocks]);
+  auto reduce_blocks = [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; ++b) {
+      auto from = first + b * block;
+      auto to = first + std::min(n, (b + 1) * block);
+      T total = *from;
+      for (++from; from != to; ++from) total = op(total, *from);
+      totals[b].emplace(std::move(total));
+    }
+  };
+  internal::split(pool, 0, blocks, 1, reduce_blocks);
+  for (size_t b = 1; b < blocks; ++b) {
+    totals[b].emplace(op(*totals[b - 1], *totals[b]));
+  }
+  auto scan_blocks = [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; ++b) {
+      auto from = first + b * block;
+      auto to = first + std::min(n, (b + 1) * block);
+      auto out = d_first + b * block;
+      T running = b ? op(*totals[b - 1], *from) : T(*from);
+      *out = running;
+      for (++from, ++out; from != to; ++from, ++out) {
+        running = op(running, *from);
+        *out = running;
+      }
+    }
+  };
+  internal::split(pool, 0, blocks, 1, scan_blocks);
+  return d_first + n;
+}
+template <class RandomIt, class OutputIt, class BinaryOp = std::plus<>>
+OutputIt inclusive_scan(RandomIt first, RandomIt last, OutputIt d_first,
+                        BinaryOp op = BinaryOp()) {
+  return inclusive_scan(default_pool(), first, last, d_first, op);
+}
+
+// not stable; sorts in place and never copies an element, so move-only
+// types are fine
+template <class RandomIt, class Compare = std::less<>>
+void sort(ThreadPool& pool, RandomIt first, RandomIt last,
+          Compare comp = Compare()) {
+  size_t n = last - first;
+  if (n < kSequentialCutoff) {
+    std::sort(first, last, comp);
+    return;
+  }
+  int depth = 0;
+  for (size_t i = n; i > 1; i /= 2) depth += 2;
+  internal::quicksort(pool, first, last, internal::grain(pool, n), depth,
+                      comp);
+}
+template <class RandomIt, class Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  sort(default_pool(), first, last, comp);
+}
+
+// Parallel merge sort; takes a buffer as large as the range, into which
+// the elements are moved first, so they must be move constructible.
+template <class RandomIt, class Compare = std::less<>>
+void stable_sort(ThreadPool& pool, RandomIt first, RandomIt last,
+                 Compare comp = Compare()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  size_t n = last - first;
+  if (n < kSequentialCutoff) {
+    std::stable_sort(first, last, comp);
+    return;
+  }
+  std::allocator<T> alloc;
+  T* buffer = alloc.allocate(n);
+  size_t grain = internal::grain(pool, n);
+  auto fill = [&](size_t begin, size_t end) {
+    std::uninitialized_move(first + begin, first + end, buffer + begin);
+  };
+  internal::split(pool, 0, n, grain, fill);
+  try {
+    // the elements now live in the buffer and end up back in place
+    internal::merge_sort(pool, buffer, first, n, grain, true, comp);
+  } catch (...) {
+    std::destroy_n(buffer, n);
+    alloc.deallocate(buffer, n);
+    throw;
+  }
+  std::destroy_n(buffer, n);
+  alloc.deallocate(buffer, n);
+}
+template <class RandomIt, class Compare = std::less<>>
+void stable_sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  stable_sort(default_pool(), first, last, comp);
+}
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // SRC_S21_PARALLEL_H_
@@ -0,0 +1,143 @@
+#ifndef SRC_S21_POOL_H_
+#define SRC_S21_POOL_H_
+
+#include "s21_helpsrc.h"
+
+namespace s21 {
+// Fixed-size slot pool. Slots are carved out of chunks of slots_per_chunk
+// slots and freed slots are kept on an intrusive free list for reuse; chunks
+// are only returned to the system when the pool is destroyed. The slot size
+// is taken from the first allocation, requests of any other size go straight
+// to operator new.
+class SlabPool {
+ public:
+  explicit SlabPool(size_t slots_per_chunk = 256)
+      : slots_per_chunk_(slots_per_chunk ? slots_per_chunk : 1) {}
+  SlabPool(const SlabPool&) = delete;
+  SlabPool& operator=(const SlabPool&) = delete;
+  ~SlabPool() { release(); }
+
+  void* allocate(size_t bytes) {
+    if (!slot_size_) slot_size_ = round_up(std::max(bytes, sizeof(FreeSlot)));
+    if (round_up(bytes) != slot_size_) return ::operator new(bytes);
+    if (free_list_) {
+      FreeSlot* slot = free_list_;
+      free_list_ = slot->next;
+      return slot;
+    }
+    if (cursor_ == chunk_end_) add_chunk();
+    void* slot = cursor_;
+    cursor_ += slot_size_;
+    return slot;
+  }
+
+  void deallocate(void* ptr, size_t bytes) noexcept {
+    if (!ptr) return;
+    if (round_up(bytes) != slot_size_) {
+      ::operator delete(ptr);
+      return;
+    }
+    FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+    slot->next = free_list_;
+    free_list_ = slot;
+  }
+
+  // frees every chunk at once; all slots handed out become invalid
+  void release() noexcept {
+    while (chunks_) {
+      Chunk* prev = chunks_->prev;
+      ::operator delete(chunks_);
+      chunks_ = prev;
+    }
+    free_list_ = nullptr;
+    cursor_ = chunk_end_ = nullptr;
+    chunk_count_ = 0;
+  }
+
+  size_t slot_size() const { return slot_size_; }
+  size_t chunk_count() const { return chunk_count_; }
+
+ private:
+  struct FreeSlot {
+    FreeSlot* next;
+  };
+  struct alignas(std::max_align_t) Chunk {
+    Chunk* prev;
+  };
+
+  size_t slots_per_chunk_;
+  size_t slot_size_ = 0;
+  size_t chunk_count_ = 0;
+  FreeSlot* free_list_ = nullptr;
+  Chunk* chunks_ = nullptr;
+  char* cursor_ = nullptr;  // next never used slot of the newest chunk
+  char* chunk_end_ = nullptr;
+
+  static size_t round_up(size_t bytes) {
+    const size_t align = alignof(std::max_align_t);
+    return (bytes + align - 1) / align * align;
+  }
+
+  void add_chunk() {
+    Chunk* chunk = static_cast<Chunk*>(
+        ::operator new(sizeof(Chunk) + slot_size_ * slots_per_chunk_));
+    chunk->prev = chunks_;
+    chunks_ = chunk;
+    ++chunk_count_;
+    cursor_ = reinterpret_cast<char*>(chunk + 1);
+    chunk_end_ = cursor_ + slot_size_ * slots_per_chunk_;
+  }
+};
+
+// Node allocator backed by a SlabPool. Copies and rebound copies share one
+// pool, while a container copy gets a fresh pool of its own through
+// select_on_container_copy_construction.
+template <typename T, size_t SlotsPerChunk = 256>
+class PoolAllocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "over-aligned types are not supported by the pool");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = PoolAllocator<U, SlotsPerChunk>;
+  };
+
+  PoolAllocator() : pool_(std::make_shared<SlabPool>(SlotsPerChunk)) {}
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U, SlotsPerChunk>& other) noexcept
+      : pool_(other.pool()) {}
+
+  T* allocate(size_type n) {
+    return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+  }
+  void deallocate(T* ptr, size_type n) noexcept {
+    pool_->deallocate(ptr, n * sizeof(T));
+  }
+  PoolAllocator select_on_container_copy_construction() const {
+    return PoolAllocator();
+  }
+
+  const std::shared_ptr<SlabPool>& pool() const { return pool_; }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U, SlotsPerChunk>& other) const {
+    return pool_ == other.pool();
+  }
+  template <typename U>
+  bool operator!=(const PoolAllocator<U, SlotsPerChunk>& other) const {
+    return pool_ != other.pool();
+  }
+
+ private:
+  std::shared_ptr<SlabPool> pool_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_POOL_H_
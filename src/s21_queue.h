@@ -20,6 +20,10 @@ class Queue {
  public:
   //  Queue Member functions
   Queue() : ListBased() {}
+  // builds the underlying container with alloc, e.g. a pmr resource
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit Queue(const Alloc& alloc) : ListBased(alloc) {}
   Queue(std::initializer_list<value_type> const& items) : ListBased(items) {}
   Queue(const Queue& q) : ListBased(q.ListBased) {}
   Queue(Queue&& q) : ListBased(std::move(q.ListBased)) {}
@@ -48,6 +52,11 @@ class Queue {
     return ListBased.insert_many_back(std::forward<Args>(args)...);
   }
 };
+
+namespace pmr {
+template <class T>
+using Queue = s21::Queue<T, s21::pmr::List<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // SRC_S21_CONTAINERS_QUEUE_H_
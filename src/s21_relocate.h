@@ -0,0 +1,78 @@
+#ifndef SRC_S21_RELOCATE_H_
+#define SRC_S21_RELOCATE_H_
+#include "s21_helpsrc.h"
+#include "s21_stats.h"
+namespace s21 {
+// Element moves shared by the contiguous containers, Vector and SmallVector,
+// which only differ in where their storage comes from.
+namespace internal {
+// Copies or moves count elements into uninitialized storage; the caller
+// destroys the originals. Trivially copyable types go with one memcpy, others
+// are moved when that cannot throw (or when they cannot be copied) and copied
+// otherwise, so a throwing transfer leaves the source untouched.
+template <typename T>
+void transfer(stats::Kind kind, T* from, size_t count, T* to) {
+  stats::on_transfer<T>(kind, count);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (count) std::memcpy(to, from, count * sizeof(T));
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    std::uninitialized_move(from, from + count, to);
+  } else {
+    std::uninitialized_copy(from, from + count, to);
+  }
+}
+
+// Builds the size elements of arr with [first, first + count) before index
+// in the uninitialized storage at to. The new elements are built before
+// anything is taken from arr; when something throws, whatever was built at
+// to is destroyed again and the caller only has to free it.
+template <typename T, typename ForwardIt>
+void insert_relocating(stats::Kind kind, T* arr, size_t size, size_t index,
+                       ForwardIt first, size_t count, T* to) {
+  T* gap = to + index;
+  std::uninitialized_copy_n(first, count, gap);
+  try {
+    transfer(kind, arr, index, to);
+  } catch (...) {
+    std::destroy_n(gap, count);
+    throw;
+  }
+  try {
+    transfer(kind, arr + index, size - index, gap + count);
+  } catch (...) {
+    std::destroy_n(to, index + count);
+    throw;
+  }
+}
+
+// Inserts [first, first + count) before index into arr, which has room for
+// them, shifting the tail only once; size grows as the elements are built.
+template <typename T, typename ForwardIt>
+void insert_shifting(stats::Kind kind, T* arr, size_t& size, size_t index,
+                     ForwardIt first, size_t count) {
+  T* pos = arr + index;
+  T* end = arr + size;
+  size_t after = size - index;
+  stats::on_move(kind, after);
+  if (after > count) {
+    std::uninitialized_move(end - count, end, end);
+    size += count;
+    std::move_backward(pos, end - count, end);
+    std::copy_n(first, count, pos);
+  } else {
+    ForwardIt middle = std::next(first, after);
+    std::uninitialized_copy_n(middle, count - after, end);
+    try {
+      std::uninitialized_move(pos, end, pos + count);
+    } catch (...) {
+      std::destroy_n(end, count - after);
+      throw;
+    }
+    size += count;
+    std::copy_n(first, after, pos);
+  }
+}
+}  // namespace internal
+}  // namespace s21
+#endif  // SRC_S21_RELOCATE_H_
@@ -2,10 +2,18 @@
 #define SRC_S21_SET_H_
 
 #include "s21_helpsrc.h"
+#include "s21_tree.h"
 #include "s21_vector.h"
 namespace s21 {
-template <typename T>
+template <typename T, typename Compare = std::less<T>,
+          typename Alloc = std::allocator<T>>
 class Set {
+  using tree_type = Tree<T, T, KeyIdentity<T>, Compare, Alloc>;
+  static constexpr bool kNothrowMoveAssign =
+      std::is_nothrow_move_assignable_v<tree_type>;
+  template <typename Q, typename R>
+  using if_transparent = typename tree_type::template if_transparent<Q, R>;
+
  public:
   using key_type = T;
   using value_type = T;  // value type (the value itself is a key)
@@ -15,434 +23,382 @@ class Set {
       const value_type&;     // defines the type of the constant reference
   using size_type = size_t;  // defines the type of the container size (standard
                              // type is size_t)
+  using key_compare = Compare;
+  using allocator_type = Alloc;
 
-  struct Node {
-    value_type value;
-    Node* parent = nullptr;
-    Node* left = nullptr;
-    Node* right = nullptr;
-    Node(const value_type& v) : value(v){};
-    ~Node() = default;
-  };
-
-  class SetIterator {
-   public:
-    using iterator = SetIterator;
-    SetIterator() : node_(nullptr) {}
-    SetIterator(Node* node) : node_(node) {}
-    SetIterator(const SetIterator& other) : node_(other.node_) {}
-    SetIterator(const Node* node) : node_(const_cast<Node*>(node)) {}
-    Node* current() const { return node_; }
-    bool operator==(const iterator& other) const {
-      return node_ == other.node_;
-    }
-    bool operator!=(const iterator& other) const {
-      return node_ != other.node_;
-    }
-    reference operator*() const { return node_->value; }
-    iterator& operator++() {
-      if (!node_) {
-        return *this;
-      }
-      if (node_->right) {
-        node_ = node_->right;
-        while (node_->left) {
-          node_ = node_->left;
-        }
-      } else {
-        Node* parent = node_->parent;
-        while (parent && node_ == parent->right) {
-          node_ = parent;
-          parent = parent->parent;
-        }
-        node_ = parent;
-      }
-      return *this;
-    }
-    iterator operator++(int) {
-      iterator temp(*this);
-      ++(*this);
-      return temp;
-    }
-
-   protected:
-    Node* node_ = nullptr;
-  };
-
-  class SetConstIterator : public SetIterator {
-   public:
-    using const_iterator = SetConstIterator;
-    SetConstIterator() : SetIterator() {}
-    SetConstIterator(Node* node) : SetIterator(node) {}
-    SetConstIterator(const SetIterator& it) : SetIterator(it.node_) {}
-    bool operator==(const_iterator& other) const {
-      return SetIterator::node_ == other.node_;
-    }
-    bool operator!=(const_iterator& other) const {
-      return SetIterator::node_ != other.node_;
-    }
-    const_reference operator*() const { return SetIterator::node_->value; }
-    const_iterator& operator++() {
-      SetIterator::operator++();
-      return *this;
-    }
-    const_iterator operator++(int) {
-      iterator temp(*this);
-      SetIterator::operator++();
-      return temp;
-    }
-  };
-
+  using Node = typename tree_type::Node;
+  using SetIterator = typename tree_type::iterator;
+  using SetConstIterator = typename tree_type::const_iterator;
   using iterator = SetIterator;
   using const_iterator = SetConstIterator;
+  using reverse_iterator = typename tree_type::reverse_iterator;
+  using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   Set();  // default constructor, creates empty set
-  Set(std::initializer_list<value_type> const&
-          items);         // initializer list constructor
+  explicit Set(const allocator_type& alloc);  // empty, nodes from alloc
+  explicit Set(const key_compare& comp,
+               const allocator_type& alloc = allocator_type());
+  Set(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc =
+          allocator_type());  // initializer list constructor
   Set(const Set& other);  // copy constructor
   Set(Set&& s) noexcept;  // move constructor
   ~Set();                 // destructor
 
-  Set<value_type>& operator=(
-      Set<value_type>&&
-          other) noexcept;  // assignment operator overload for moving object
+  // builds the set from a range sorted by key in O(n)
+  template <typename ForwardIt>
+  static Set from_sorted(ForwardIt first, ForwardIt last);
+
+  // assignment operator overload for moving object
+  Set& operator=(Set&& other) noexcept(kNothrowMoveAssign);
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
 
   iterator begin();              // returns an iterator to the beginning
   const_iterator begin() const;  // returns an iterator to the beginning
   iterator end();                // returns an iterator to the end
   const_iterator end() const;    // returns an iterator to the end
+  reverse_iterator rbegin();     // the largest element first, in O(1)
+  const_reverse_iterator rbegin() const;
+  reverse_iterator rend();
+  const_reverse_iterator rend() const;
+  const_reference front() const;  // the smallest element, in O(1)
+  const_reference back() const;   // the largest element, in O(1)
   bool empty() const;
   size_t size() const;
   size_type max_size();   // returns the maximum possible number of elements
   void clear() noexcept;  // clears the contents
 
   std::pair<iterator, bool> insert(const value_type& v);
+  iterator insert(const_iterator hint,
+                  const value_type& v);  // inserts v as close before hint
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first,
+                     ForwardIt last);  // replaces contents with sorted range
+  insert_return_type insert(node_type&& nh);  // links an extracted node
+  node_type extract(const_iterator pos);      // unlinks the node at pos
+  node_type extract(const key_type& key);     // unlinks the node with key
   void erase(iterator pos);            // erases element at pos
   void swap(Set& other);               // swaps the contents
   void merge(Set& other);              // splices nodes from another container
   iterator find(const key_type& key);  // finds element with specific key
   bool contains(
       const key_type& v) const;  // checks if the container contains element
+  iterator lower_bound(const key_type& key);  // first element >= key
+  iterator upper_bound(const key_type& key);  // first element > key
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+  // lookups by any key type a transparent Compare such as std::less<> takes
+  template <typename Q>
+  if_transparent<Q, iterator> find(const Q& key) {
+    return tree_.find(key);
+  }
+  template <typename Q>
+  if_transparent<Q, bool> contains(const Q& key) const {
+    return tree_.contains(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> lower_bound(const Q& key) {
+    return tree_.lower_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> upper_bound(const Q& key) {
+    return tree_.upper_bound(key);
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<iterator, iterator>> equal_range(const Q& key) {
+    return tree_.equal_range(key);
+  }
+  iterator nth(size_type k);  // k-th element in order, end() if k >= size
+  size_type rank(const key_type& key) const;  // number of elements < key
+  size_type count_range(const key_type& lo,
+                        const key_type& hi) const;  // elements in [lo, hi)
+  TreeDebugStats debug_stats() const;  // height and depths, visits every node
+  double sampled_depth(size_type samples = 64) const;  // estimated avg depth
 
   template <typename... Args>
   Vector<std::pair<iterator, bool>> insert_many(Args&&... args);
   void print() const;
 
  private:
-  Node* root_ = nullptr;
-  size_t size_ = 0;
-
-  Node* copy(const Node* node, Node* parent);
-  std::pair<iterator, bool> insert(const value_type& v, Node* node);
-  bool contains(const key_type& v, const Node* node) const;
-  iterator find(const key_type& key, const Node* node);
-  void erase(iterator it, Node* node);
-  void destroy_tree(Node* node) noexcept;
-  void print_tree(Node* node) const;
+  tree_type tree_;
 };
 
 //--------------------------------------------------------------------
 // Implementation
 //--------------------------------------------------------------------
 
-template <typename value_type>
-Set<value_type>::Set() : root_(nullptr), size_(0) {}
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set() : tree_() {}
 
-template <typename value_type>
-Set<value_type>::Set(const Set& other) : root_(nullptr), size_(0) {
-  if (other.root_) {
-    root_ = copy(other.root_, nullptr);
-    size_ = other.size_;
-  }
-}
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set(const allocator_type& alloc)
+    : tree_(alloc) {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set(const key_compare& comp,
+                                     const allocator_type& alloc)
+    : tree_(comp, alloc) {}
 
-template <typename value_type>
-Set<value_type>::Set(std::initializer_list<value_type> const& items) {
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set(const Set& other) : tree_(other.tree_) {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set(
+    std::initializer_list<value_type> const& items, const allocator_type& alloc)
+    : tree_(alloc) {
   if (items.size() > max_size()) throw std::bad_alloc();
   for (const auto& value : items) {
     insert(value);
   }
 }
 
-template <typename value_type>
-Set<value_type>::Set(Set&& other) noexcept {
-  root_ = other.root_;
-  size_ = other.size_;
-  other.root_ = nullptr;
-  other.size_ = 0;
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::Set(Set&& other) noexcept
+    : tree_(std::move(other.tree_)) {}
+
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>::~Set() = default;
+
+template <typename value_type, typename Compare, typename Alloc>
+Set<value_type, Compare, Alloc>& Set<value_type, Compare, Alloc>::operator=(
+    Set<value_type, Compare, Alloc>&& other) noexcept(kNothrowMoveAssign) {
+  tree_ = std::move(other.tree_);
+  return *this;
 }
 
-template <typename value_type>
-Set<value_type>::~Set() {
-  destroy_tree(root_);
+template <typename value_type, typename Compare, typename Alloc>
+Alloc Set<value_type, Compare, Alloc>::get_allocator() const {
+  return tree_.get_allocator();
 }
 
-template <typename value_type>
-Set<value_type>& Set<value_type>::operator=(Set<value_type>&& other) noexcept {
-  if (this != &other) {
-    destroy_tree(root_);
-    root_ = other.root_;
-    size_ = other.size_;
-    other.root_ = nullptr;
-    other.size_ = 0;
-  }
-  return *this;
+template <typename value_type, typename Compare, typename Alloc>
+Compare Set<value_type, Compare, Alloc>::key_comp() const {
+  return tree_.key_comp();
 }
 
-template <typename value_type>
-std::pair<typename Set<value_type>::iterator, bool> Set<value_type>::insert(
-    const value_type& v) {
-  if (!root_) {
-    root_ = new Node(v);
-    ++size_;
-    return std::make_pair(iterator(root_), true);
-  } else {
-    return insert(v, root_);
-  }
+template <typename value_type, typename Compare, typename Alloc>
+std::pair<typename Set<value_type, Compare, Alloc>::iterator, bool>
+Set<value_type, Compare, Alloc>::insert(const value_type& v) {
+  return tree_.insert_unique(v);
 }
 
-template <typename key_type>
-bool Set<key_type>::contains(const key_type& v) const {
-  return contains(v, root_);
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::iterator
+Set<value_type, Compare, Alloc>::insert(
+    const_iterator hint, const value_type& v) {
+  return tree_.insert_unique(hint, v);
 }
 
-template <typename value_type>
-void s21::Set<value_type>::erase(iterator it) {
-  erase(it, root_);
+template <typename value_type, typename Compare, typename Alloc>
+template <typename ForwardIt>
+Set<value_type, Compare, Alloc> Set<value_type, Compare, Alloc>::from_sorted(
+    ForwardIt first, ForwardIt last) {
+  Set result;
+  result.assign_sorted(first, last);
+  return result;
 }
 
-template <typename value_type>
-void s21::Set<value_type>::swap(Set& other) {
-  Node* tmp_root = root_;
-  size_t tmp_size = size_;
-  this->root_ = other.root_;
-  other.root_ = tmp_root;
-  this->size_ = other.size_;
-  other.size_ = tmp_size;
+template <typename value_type, typename Compare, typename Alloc>
+template <typename ForwardIt>
+void Set<value_type, Compare, Alloc>::assign_sorted(
+    ForwardIt first, ForwardIt last) {
+  tree_.assign_sorted(first, last, true);
 }
 
-template <typename value_type>
-void s21::Set<value_type>::merge(Set& other) {
-  if (this->root_ == other.root_) return;
-  auto it = other.begin();
-  for (size_t i = 0; i < other.size_; ++i) {
-    this->insert(*it);
-    ++it;
-  }
-  other.clear();
+template <typename key_type, typename Compare, typename Alloc>
+bool Set<key_type, Compare, Alloc>::contains(const key_type& v) const {
+  return tree_.contains(v);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Set<value_type, Compare, Alloc>::erase(iterator it) {
+  tree_.erase(it);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Set<value_type, Compare, Alloc>::swap(Set& other) {
+  tree_.swap(other.tree_);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Set<value_type, Compare, Alloc>::merge(Set& other) {
+  if (this == &other) return;
+  tree_.merge_unique(other.tree_);
+  other.clear();  // only keys that were already here are left
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::insert_return_type
+Set<value_type, Compare, Alloc>::insert(node_type&& nh) {
+  return tree_.insert_unique(std::move(nh));
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::node_type
+Set<value_type, Compare, Alloc>::extract(const_iterator pos) {
+  return tree_.extract(pos);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::node_type
+Set<value_type, Compare, Alloc>::extract(const key_type& key) {
+  return tree_.extract(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+typename Set<key_type, Compare, Alloc>::iterator
+s21::Set<key_type, Compare, Alloc>::find(const key_type& key) {
+  return tree_.find(key);
 }
 
-template <typename key_type>
-typename Set<key_type>::iterator s21::Set<key_type>::find(const key_type& key) {
-  return find(key, root_);
+template <typename key_type, typename Compare, typename Alloc>
+typename Set<key_type, Compare, Alloc>::iterator
+Set<key_type, Compare, Alloc>::lower_bound(const key_type& key) {
+  return tree_.lower_bound(key);
 }
 
-template <typename value_type>
-size_t Set<value_type>::size() const {
-  return size_;
+template <typename key_type, typename Compare, typename Alloc>
+typename Set<key_type, Compare, Alloc>::iterator
+Set<key_type, Compare, Alloc>::upper_bound(const key_type& key) {
+  return tree_.upper_bound(key);
 }
 
-template <typename value_type>
-size_t s21::Set<value_type>::max_size() {
+template <typename key_type, typename Compare, typename Alloc>
+std::pair<typename Set<key_type, Compare, Alloc>::iterator,
+          typename Set<key_type, Compare, Alloc>::iterator>
+Set<key_type, Compare, Alloc>::equal_range(const key_type& key) {
+  return tree_.equal_range(key);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::iterator
+Set<value_type, Compare, Alloc>::nth(size_type k) {
+  return tree_.nth(k);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+size_t Set<key_type, Compare, Alloc>::rank(const key_type& key) const {
+  return tree_.rank(key);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+size_t Set<key_type, Compare, Alloc>::count_range(const key_type& lo,
+                                                  const key_type& hi) const {
+  return tree_.count_range(lo, hi);
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+TreeDebugStats Set<key_type, Compare, Alloc>::debug_stats() const {
+  return tree_.debug_stats();
+}
+
+template <typename key_type, typename Compare, typename Alloc>
+double Set<key_type, Compare, Alloc>::sampled_depth(size_type samples) const {
+  return tree_.sampled_depth(samples);
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+size_t Set<value_type, Compare, Alloc>::size() const {
+  return tree_.size();
+}
+
+template <typename value_type, typename Compare, typename Alloc>
+size_t s21::Set<value_type, Compare, Alloc>::max_size() {
   return SIZE_MAX / sizeof(value_type);
 }
 
-template <typename value_type>
-void s21::Set<value_type>::clear() noexcept {
-  destroy_tree(root_);
-  root_ = nullptr;
-  size_ = 0;
+template <typename value_type, typename Compare, typename Alloc>
+void s21::Set<value_type, Compare, Alloc>::clear() noexcept {
+  tree_.clear();
 }
 
-template <typename value_type>
-bool Set<value_type>::empty() const {
-  return size_ == 0;
+template <typename value_type, typename Compare, typename Alloc>
+bool Set<value_type, Compare, Alloc>::empty() const {
+  return tree_.empty();
 }
 
-template <typename value_type>
-typename Set<value_type>::iterator s21::Set<value_type>::begin() {
-  Node* node = root_;
-  while (node && node->left) {
-    node = node->left;
-  }
-  return iterator(node);
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::iterator
+s21::Set<value_type, Compare, Alloc>::begin() {
+  return tree_.begin();
 }
 
-template <typename value_type>
-typename Set<value_type>::const_iterator s21::Set<value_type>::begin() const {
-  Node* node = root_;
-  while (node && node->left) {
-    node = node->left;
-  }
-  return const_iterator(node);
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::const_iterator
+s21::Set<value_type, Compare, Alloc>::begin() const {
+  return tree_.begin();
 }
 
-template <typename value_type>
-typename s21::Set<value_type>::iterator Set<value_type>::end() {
-  return iterator(static_cast<typename s21::Set<value_type>::Node*>(nullptr));
+template <typename value_type, typename Compare, typename Alloc>
+typename s21::Set<value_type, Compare, Alloc>::iterator
+Set<value_type, Compare, Alloc>::end() {
+  return tree_.end();
 }
 
-template <typename value_type>
-typename s21::Set<value_type>::const_iterator Set<value_type>::end() const {
-  return const_iterator(
-      static_cast<typename s21::Set<value_type>::Node*>(nullptr));
+template <typename value_type, typename Compare, typename Alloc>
+typename s21::Set<value_type, Compare, Alloc>::const_iterator
+Set<value_type, Compare, Alloc>::end() const {
+  return tree_.end();
 }
 
-//--------------------------------------------------------------------
-// Implementation private
-//--------------------------------------------------------------------
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::reverse_iterator
+Set<value_type, Compare, Alloc>::rbegin() {
+  return tree_.rbegin();
+}
 
-template <typename value_type>
-typename s21::Set<value_type>::Node* Set<value_type>::copy(const Node* node,
-                                                           Node* parent) {
-  if (!node) {
-    return nullptr;
-  }
-  Node* new_node = new Node(node->value);
-  new_node->parent = parent;
-  new_node->left = copy(node->left, new_node);
-  new_node->right = copy(node->right, new_node);
-  return new_node;
-}
-
-template <typename value_type>
-std::pair<typename Set<value_type>::iterator, bool> Set<value_type>::insert(
-    const value_type& v, Node* node) {
-  if (!node) {
-    root_ = new Node(v);
-    ++size_;
-    return std::make_pair(iterator(root_), true);
-  }
-  if (v < node->value) {
-    if (!node->left) {
-      node->left = new Node(v);
-      node->left->parent = node;
-      ++size_;
-      return std::make_pair(iterator(node->left), true);
-    } else {
-      return insert(v, node->left);
-    }
-  } else if (v > node->value) {
-    if (!node->right) {
-      node->right = new Node(v);
-      node->right->parent = node;
-      ++size_;
-      return std::make_pair(iterator(node->right), true);
-    } else {
-      return insert(v, node->right);
-    }
-  } else {
-    return std::make_pair(iterator(node), false);
-  }
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::const_reverse_iterator
+Set<value_type, Compare, Alloc>::rbegin() const {
+  return tree_.rbegin();
 }
 
-template <typename value_type>
-void s21::Set<value_type>::destroy_tree(Node* node) noexcept {
-  if (node != nullptr) {
-    destroy_tree(node->left);
-    destroy_tree(node->right);
-    node->left = nullptr;
-    node->right = nullptr;
-    delete node;
-  }
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::reverse_iterator
+Set<value_type, Compare, Alloc>::rend() {
+  return tree_.rend();
 }
 
-template <typename key_type>
-bool Set<key_type>::contains(const key_type& v, const Node* node) const {
-  if (!node) {
-    return false;
-  }
-  if (v == node->value) {
-    return true;
-  }
-  if (v < node->value) {
-    return contains(v, node->left);
-  } else {
-    return contains(v, node->right);
-  }
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::const_reverse_iterator
+Set<value_type, Compare, Alloc>::rend() const {
+  return tree_.rend();
 }
 
-template <typename value_type>
-void Set<value_type>::erase(iterator it, Node* node) {
-  if (!node) {
-    return;
-  }
-  if (*it < node->value) {
-    erase(it, node->left);
-  } else if (*it > node->value) {
-    erase(it, node->right);
-  } else {
-    if (!node->left && !node->right) {
-      if (node == root_) {
-        root_ = nullptr;
-      } else if (node == node->parent->left) {
-        node->parent->left = nullptr;
-      } else {
-        node->parent->right = nullptr;
-      }
-      delete node;
-      --size_;
-    } else if (node->left && node->right) {
-      Node* min_node = node->right;
-      while (min_node->left) {
-        min_node = min_node->left;
-      }
-      node->value = min_node->value;
-      erase(iterator(min_node), min_node);
-    } else {
-      Node* child = node->left ? node->left : node->right;
-      if (node == root_) {
-        root_ = child;
-        child->parent = nullptr;
-      } else if (node == node->parent->left) {
-        node->parent->left = child;
-        child->parent = node->parent;
-      } else {
-        node->parent->right = child;
-        child->parent = node->parent;
-      }
-      delete node;
-      --size_;
-    }
-  }
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::const_reference
+Set<value_type, Compare, Alloc>::front() const {
+  return *tree_.begin();
 }
 
-template <typename key_type>
-typename Set<key_type>::iterator s21::Set<key_type>::find(const key_type& key,
-                                                          const Node* node) {
-  if (!node) return iterator();
-  if (key == node->value) {
-    return iterator(node);
-  }
-  if (key > node->value) {
-    return find(key, node->right);
-  } else {
-    return find(key, node->left);
-  }
+template <typename value_type, typename Compare, typename Alloc>
+typename Set<value_type, Compare, Alloc>::const_reference
+Set<value_type, Compare, Alloc>::back() const {
+  return *tree_.rbegin();
 }
 
-template <typename value_type>
+template <typename value_type, typename Compare, typename Alloc>
 template <typename... Args>
-Vector<std::pair<typename Set<value_type>::iterator, bool>>
-Set<value_type>::insert_many(Args&&... args) {
+Vector<std::pair<typename Set<value_type, Compare, Alloc>::iterator, bool>>
+Set<value_type, Compare, Alloc>::insert_many(Args&&... args) {
   Vector<std::pair<iterator, bool>> result = {
       (insert(std::forward<Args>(args)))...};
   return result;
 }
 
-template <typename value_type>
-void Set<value_type>::print_tree(Node* node) const {
-  if (node) {
-    print_tree(node->left);
-    std::cout << node->value << " ";
-    print_tree(node->right);
+template <typename value_type, typename Compare, typename Alloc>
+void Set<value_type, Compare, Alloc>::print() const {
+  for (auto it = begin(); it != end(); ++it) {
+    std::cout << *it << " ";
   }
-}
-
-template <typename value_type>
-void Set<value_type>::print() const {
-  print_tree(root_);
   std::cout << std::endl;
 }
+
+namespace pmr {
+template <typename T>
+using Set = s21::Set<T, std::less<T>, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
-#endif  // SRC_S21_SET_H_
\ No newline at end of file
+#endif  // SRC_S21_SET_H_
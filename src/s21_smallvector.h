@@ -0,0 +1,475 @@
+#ifndef SRC_S21_SMALLVECTOR_H_
+#define SRC_S21_SMALLVECTOR_H_
+#include "s21_helpsrc.h"
+#include "s21_relocate.h"
+#include "s21_stats.h"
+namespace s21 {
+// Vector with room for N elements inside the object itself. Nothing is
+// allocated until the size goes past N, at which point the elements move to
+// the heap the same way s21::Vector grows.
+template <typename T, size_t N = 8>
+class SmallVector {
+  static_assert(N > 0, "SmallVector needs inline room for an element");
+  static constexpr stats::Kind kStats = stats::Kind::kSmallVector;
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = size_t;
+
+  SmallVector();  // default constructor, creates empty vector
+  SmallVector(
+      size_type n);  // parameterized constructor, creates the vector of size n
+  SmallVector(std::initializer_list<value_type> const&
+                  items);  // initializer list constructor
+  SmallVector(const SmallVector& v);  // copy constructor
+  SmallVector(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);  // move constructor
+  SmallVector& operator=(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);  // assignment operator
+                                                 // overload for moving object
+  ~SmallVector();                                // destructor
+
+  reference at(size_type pos);  // access specified element with bounds checking
+  reference operator[](size_type pos);  // access specified element
+  const_reference front();              // access the first element
+  const_reference back();               // access the last element
+  iterator data();                      // direct access to the underlying array
+
+  iterator begin();  // returns an iterator to the beginning
+  iterator end();    // returns an iterator to the end
+
+  void resize(size_type new_size);  // change size
+  bool empty();                     // checks whether the container is empty
+  size_type size();                 // returns the number of elements
+  size_type max_size();  // returns the maximum possible number of elements
+  void reserve(size_type new_capacity);  // allocate storage of size elements
+  size_type capacity();  // returns the number of elements that can be held in
+                         // currently allocated storage
+  void shrink_to_fit();  // reduces memory usage, moving the elements back
+                         // inline when they fit
+  bool is_inline() const;  // whether the elements live inside the object
+
+  void clear();  // clears the contents
+  iterator insert(
+      iterator pos,
+      const_reference value);  // inserts elements into concrete pos and returns
+                               // the iterator that points to the new element
+  template <typename InputIt,
+            typename = std::enable_if_t<std::is_convertible_v<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>>>
+  iterator insert(const_iterator pos, InputIt first,
+                  InputIt last);  // inserts [first, last) before pos
+  template <typename Range>
+  void append_range(Range&& range);       // appends the elements of range
+  void erase(iterator pos);               // erases element at pos
+  void push_back(const_reference value);  // adds an element to the end
+  void push_back(value_type&& value);     // moves an element to the end
+  template <typename... Args>
+  reference emplace_back(
+      Args&&... args);  // constructs an element in place at the end
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args&&... args);  // constructs an element in place
+                                     // before pos
+  void pop_back();                   // removes the last element
+  void swap(SmallVector& other);     // swaps the contents
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos,
+                       Args&&... args);  // inserts new elements into the
+                                         // container directly before pos
+  template <typename... Args>
+  void insert_many_back(
+      Args&&... args);  // appends new elements to the end of the container
+
+ private:
+  T* arr_;
+  size_t capacity_;
+  size_t size_;
+  alignas(T) int8_t buffer_[N * sizeof(T)];
+
+  value_type* inline_data();
+  static value_type* allocate(size_type n);
+  static void deallocate(value_type* p, size_type n) noexcept;
+  void release();
+  void take(SmallVector& v);
+  void reallocate(size_type new_capacity);
+  template <typename ForwardIt>
+  iterator insert_forward(size_type index, ForwardIt first, size_type count);
+};
+//--------------------------------------------------------------------
+// Implementation
+//--------------------------------------------------------------------
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::SmallVector()
+    : arr_(inline_data()), capacity_(N), size_(0) {}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::SmallVector(size_type n) : SmallVector() {
+  resize(n);
+}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::SmallVector(
+    std::initializer_list<value_type> const& items)
+    : SmallVector() {
+  insert(begin(), items.begin(), items.end());
+}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::SmallVector(const SmallVector& v) : SmallVector() {
+  insert(begin(), v.arr_, v.arr_ + v.size_);
+}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::SmallVector(SmallVector&& v) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>)
+    : SmallVector() {
+  take(v);
+}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>& SmallVector<value_type, N>::operator=(
+    SmallVector&& v) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>) {
+  if (this != &v) {
+    clear();
+    release();
+    take(v);
+  }
+  return *this;
+}
+
+template <typename value_type, size_t N>
+SmallVector<value_type, N>::~SmallVector() {
+  clear();
+  release();
+}
+
+template <typename value_type, size_t N>
+value_type& SmallVector<value_type, N>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return arr_[pos];
+}
+
+template <typename value_type, size_t N>
+value_type& SmallVector<value_type, N>::operator[](size_type pos) {
+  return arr_[pos];
+}
+
+template <typename value_type, size_t N>
+const value_type& SmallVector<value_type, N>::front() {
+  if (this->empty()) throw std::out_of_range("Index out of range");
+  return arr_[0];
+}
+
+template <typename value_type, size_t N>
+const value_type& SmallVector<value_type, N>::back() {
+  if (this->empty()) throw std::out_of_range("Index out of range");
+  return arr_[size_ - 1];
+}
+
+template <typename value_type, size_t N>
+value_type* SmallVector<value_type, N>::data() {
+  return arr_;
+}
+
+template <typename value_type, size_t N>
+inline value_type* SmallVector<value_type, N>::begin() {
+  return arr_;
+}
+
+template <typename value_type, size_t N>
+inline value_type* SmallVector<value_type, N>::end() {
+  return arr_ + size_;
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::resize(size_type new_size) {
+  if (new_size > capacity_) reserve(new_size);
+  for (size_t i = size_; i < new_size; ++i) {
+    new (arr_ + i) value_type();
+  }
+  if (new_size < size_) std::destroy(arr_ + new_size, arr_ + size_);
+  size_ = new_size;
+}
+
+template <typename value_type, size_t N>
+bool SmallVector<value_type, N>::empty() {
+  return size_ == 0;
+}
+
+template <typename value_type, size_t N>
+size_t SmallVector<value_type, N>::size() {
+  return size_;
+}
+
+template <typename value_type, size_t N>
+size_t SmallVector<value_type, N>::max_size() {
+  return SIZE_MAX / sizeof(value_type);
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::reserve(size_type new_capacity) {
+  if (new_capacity <= capacity_) return;
+  if (new_capacity > max_size()) throw std::bad_alloc();
+  reallocate(new_capacity);
+}
+
+template <typename value_type, size_t N>
+size_t SmallVector<value_type, N>::capacity() {
+  return capacity_;
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::shrink_to_fit() {
+  if (is_inline() || capacity_ == size_) return;
+  reallocate(size_);
+}
+
+template <typename value_type, size_t N>
+bool SmallVector<value_type, N>::is_inline() const {
+  return arr_ == reinterpret_cast<const value_type*>(buffer_);
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::clear() {
+  std::destroy_n(arr_, size_);
+  size_ = 0;
+}
+
+template <typename value_type, size_t N>
+typename SmallVector<value_type, N>::iterator
+SmallVector<value_type, N>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename value_type, size_t N>
+template <typename InputIt, typename>
+typename SmallVector<value_type, N>::iterator
+SmallVector<value_type, N>::insert(const_iterator pos, InputIt first,
+                                   InputIt last) {
+  if (pos < this->begin() || pos > this->end()) {
+    throw std::out_of_range("position is out of range");
+  }
+  size_t index = pos - this->begin();
+  if constexpr (std::is_convertible_v<
+                    typename std::iterator_traits<InputIt>::iterator_category,
+                    std::forward_iterator_tag>) {
+    return insert_forward(index, first, std::distance(first, last));
+  } else {
+    SmallVector buffer;
+    for (; first != last; ++first) buffer.emplace_back(*first);
+    return insert_forward(index, std::make_move_iterator(buffer.begin()),
+                          buffer.size());
+  }
+}
+
+template <typename value_type, size_t N>
+template <typename Range>
+void SmallVector<value_type, N>::append_range(Range&& range) {
+  insert(this->end(), std::begin(range), std::end(range));
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::erase(iterator pos) {
+  stats::on_move(kStats, end() - pos - 1);
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename value_type, size_t N>
+template <typename... Args>
+value_type& SmallVector<value_type, N>::emplace_back(Args&&... args) {
+  if (capacity_ == size_) {
+    // args may refer to an element of this vector
+    value_type value(std::forward<Args>(args)...);
+    reserve(capacity_ * 2);
+    new (arr_ + size_) value_type(std::move(value));
+    stats::on_move(kStats);
+  } else {
+    new (arr_ + size_) value_type(std::forward<Args>(args)...);
+  }
+  stats::on_construct<value_type, Args...>(kStats);
+  return arr_[size_++];
+}
+
+template <typename value_type, size_t N>
+template <typename... Args>
+typename SmallVector<value_type, N>::iterator
+SmallVector<value_type, N>::emplace(const_iterator pos, Args&&... args) {
+  if (pos < this->begin() || pos > this->end()) {
+    throw std::out_of_range("position is out of range");
+  }
+  size_t index = pos - this->begin();
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return this->begin() + index;
+  }
+  value_type value(std::forward<Args>(args)...);
+  if (size_ == capacity_) reserve(capacity_ * 2);
+  new (arr_ + size_) value_type(std::move(arr_[size_ - 1]));
+  ++size_;
+  std::move_backward(this->begin() + index, this->end() - 2, this->end() - 1);
+  arr_[index] = std::move(value);
+  stats::on_construct<value_type, Args...>(kStats);
+  stats::on_move(kStats, size_ - index);
+  return this->begin() + index;
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::pop_back() {
+  --size_;
+  (arr_ + size_)->~value_type();
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::swap(SmallVector& other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(arr_, other.arr_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    return;
+  }
+  SmallVector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename value_type, size_t N>
+template <typename... Args>
+typename SmallVector<value_type, N>::iterator
+SmallVector<value_type, N>::insert_many(const_iterator pos, Args&&... args) {
+  if constexpr (sizeof...(Args) == 0) {
+    return const_cast<iterator>(pos);
+  } else {
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+    iterator it = insert(pos, std::make_move_iterator(std::begin(values)),
+                         std::make_move_iterator(std::end(values)));
+    return it + (sizeof...(Args) - 1);
+  }
+}
+
+template <typename value_type, size_t N>
+template <typename... Args>
+void SmallVector<value_type, N>::insert_many_back(Args&&... args) {
+  insert_many(this->end(), std::forward<Args>(args)...);
+}
+
+//--------------------------------------------------------------------
+// Implementation private
+//--------------------------------------------------------------------
+
+template <typename value_type, size_t N>
+value_type* SmallVector<value_type, N>::inline_data() {
+  return reinterpret_cast<value_type*>(buffer_);
+}
+
+// heap storage comes from std::allocator, which honours over-aligned types
+template <typename value_type, size_t N>
+value_type* SmallVector<value_type, N>::allocate(size_type n) {
+  value_type* p = std::allocator<value_type>().allocate(n);
+  stats::on_allocate(kStats, n * sizeof(value_type));
+  return p;
+}
+
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::deallocate(value_type* p,
+                                            size_type n) noexcept {
+  std::allocator<value_type>().deallocate(p, n);
+  stats::on_free(kStats, n * sizeof(value_type));
+}
+
+// frees heap storage; the elements must already be destroyed
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::release() {
+  if (!is_inline()) deallocate(arr_, capacity_);
+  arr_ = inline_data();
+  capacity_ = N;
+}
+
+// Takes the elements of v into this empty vector with inline storage. A heap
+// buffer is stolen as is, inline elements have to be moved one by one.
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::take(SmallVector& v) {
+  if (v.is_inline()) {
+    internal::transfer(kStats, v.arr_, v.size_, arr_);
+    size_ = v.size_;
+    v.clear();
+  } else {
+    arr_ = v.arr_;
+    capacity_ = v.capacity_;
+    size_ = v.size_;
+    v.arr_ = v.inline_data();
+    v.capacity_ = N;
+    v.size_ = 0;
+  }
+}
+
+// moves the elements into heap storage of new_capacity elements, or back
+// into the inline buffer when new_capacity fits there
+template <typename value_type, size_t N>
+void SmallVector<value_type, N>::reallocate(size_type new_capacity) {
+  bool on_heap = new_capacity > N;
+  value_type* new_arr = on_heap ? allocate(new_capacity) : inline_data();
+  try {
+    internal::transfer(kStats, arr_, size_, new_arr);
+  } catch (...) {
+    if (on_heap) deallocate(new_arr, new_capacity);
+    throw;
+  }
+  std::destroy_n(arr_, size_);
+  release();
+  stats::on_reallocate(kStats);
+  arr_ = new_arr;
+  capacity_ = std::max(new_capacity, N);
+}
+
+template <typename value_type, size_t N>
+template <typename ForwardIt>
+typename SmallVector<value_type, N>::iterator
+SmallVector<value_type, N>::insert_forward(size_type index, ForwardIt first,
+                                           size_type count) {
+  if (count == 0) return begin() + index;
+  if (count > max_size() - size_) throw std::bad_alloc();
+  stats::on_construct<value_type, decltype(*first)>(kStats, count);
+  if (size_ + count > capacity_) {
+    size_type new_capacity = std::max(size_ + count, capacity_ * 2);
+    value_type* new_arr = allocate(new_capacity);
+    try {
+      internal::insert_relocating(kStats, arr_, size_, index, first, count,
+                                  new_arr);
+    } catch (...) {
+      deallocate(new_arr, new_capacity);
+      throw;
+    }
+    size_type new_size = size_ + count;
+    clear();
+    release();
+    stats::on_reallocate(kStats);
+    arr_ = new_arr;
+    capacity_ = new_capacity;
+    size_ = new_size;
+    return arr_ + index;
+  }
+  internal::insert_shifting(kStats, arr_, size_, index, first, count);
+  return arr_ + index;
+}
+}  // namespace s21
+#endif  // SRC_S21_SMALLVECTOR_H_
@@ -20,6 +20,10 @@ class Stack {
  public:
   //  Stack Member functions
   Stack() : ListBased() {}
+  // builds the underlying container with alloc, e.g. a pmr resource
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator_v<Container, Alloc>>>
+  explicit Stack(const Alloc& alloc) : ListBased(alloc) {}
   Stack(std::initializer_list<value_type> const& items) : ListBased(items) {}
   Stack(const Stack& s) : ListBased(s.ListBased) {}
   Stack(Stack&& s) : ListBased(std::move(s.ListBased)) {}
@@ -47,6 +51,11 @@ class Stack {
     ListBased.insert_many_back(std::forward<Args>(args)...);
   }
 };
+
+namespace pmr {
+template <class T>
+using Stack = s21::Stack<T, s21::pmr::List<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // SRC_S21_CONTAINERS_STACK_H_
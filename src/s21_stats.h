@@ -0,0 +1,295 @@
+#ifndef SRC_S21_STATS_H_
+#define SRC_S21_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_helpsrc.h"
+
+// Build with -DS21_STATS=1 to have the containers count their allocations,
+// element copies and moves and tree comparisons. Otherwise every hook below
+// is an empty inline function and the counting compiles away.
+#ifndef S21_STATS
+#define S21_STATS 0
+#endif
+
+namespace s21 {
+namespace stats {
+inline constexpr bool kEnabled = S21_STATS != 0;
+
+// Set, Multiset and Map share one tree, so they share its counters; Stack
+// and Queue count as the List under them. FlatSet and FlatMap count their
+// searches as flat_tree and the storage as the Vector it is.
+enum class Kind {
+  kVector,
+  kSmallVector,
+  kList,
+  kTree,
+  kUnorderedMap,
+  kBTreeMap,
+  kFlatTree,
+  kConcurrentQueue,
+  kCount
+};
+inline constexpr size_t kKindCount = static_cast<size_t>(Kind::kCount);
+
+inline const char* name(Kind kind) {
+  static const char* const names[kKindCount] = {
+      "vector",        "small_vector", "list",      "tree",
+      "unordered_map", "btree_map",    "flat_tree", "concurrent_queue"};
+  return names[static_cast<size_t>(kind)];
+}
+
+struct Counters {
+  uint64_t allocations = 0;
+  uint64_t frees = 0;
+  uint64_t bytes_allocated = 0;
+  uint64_t bytes_freed = 0;
+  uint64_t reallocations = 0;  // storage replaced by a new buffer
+  uint64_t copies = 0;         // elements copy constructed or assigned
+  uint64_t moves = 0;          // elements moved or relocated
+  uint64_t lookups = 0;        // tree descents and binary searches
+  uint64_t comparisons = 0;    // key comparisons made by the lookups
+
+  double comparisons_per_lookup() const {
+    return lookups ? static_cast<double>(comparisons) / lookups : 0.0;
+  }
+};
+
+struct Snapshot {
+  std::array<Counters, kKindCount> kinds;
+
+  const Counters& operator[](Kind kind) const {
+    return kinds[static_cast<size_t>(kind)];
+  }
+};
+
+namespace internal {
+enum Field : size_t {
+  kAllocations,
+  kFrees,
+  kBytesAllocated,
+  kBytesFreed,
+  kReallocations,
+  kCopies,
+  kMoves,
+  kLookups,
+  kComparisons,
+  kFieldCount
+};
+
+using Totals = std::array<std::array<uint64_t, kFieldCount>, kKindCount>;
+
+// Every counting thread owns a block. Only the owner writes to it, with a
+// relaxed load and store rather than a locked add, and the blocks of
+// different threads never share a cache line; snapshot() reads them all.
+struct alignas(64) Block {
+  Block();
+  ~Block();
+  Block(const Block&) = delete;
+  Block& operator=(const Block&) = delete;
+
+  std::array<std::array<std::atomic<uint64_t>, kFieldCount>, kKindCount>
+      counters{};
+  Totals baseline{};  // the counters at the last reset(), under the mutex
+  Block* next = nullptr;
+  Block* prev = nullptr;
+};
+
+// The live blocks, and the totals of threads that have exited. It is never
+// destroyed, so containers freed during static destruction can still count.
+struct Registry {
+  std::mutex mutex;
+  Block* blocks = nullptr;
+  Totals retired{};
+};
+
+inline Registry& registry() {
+  static Registry* instance = new Registry;
+  return *instance;
+}
+
+inline thread_local Block* current = nullptr;
+inline thread_local bool exited = false;
+
+inline Block::Block() {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  next = r.blocks;
+  if (next) next->prev = this;
+  r.blocks = this;
+  current = this;
+}
+
+inline Block::~Block() {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (size_t k = 0; k < kKindCount; ++k) {
+    for (size_t f = 0; f < kFieldCount; ++f) {
+      r.retired[k][f] +=
+          counters[k][f].load(std::memory_order_relaxed) - baseline[k][f];
+    }
+  }
+  (prev ? prev->next : r.blocks) = next;
+  if (next) next->prev = prev;
+  current = nullptr;
+  exited = true;
+}
+
+// null once the thread's block is gone, at thread or program exit
+inline Block* attach() {
+  if (exited) return nullptr;
+  thread_local Block block;
+  return &block;
+}
+
+inline void add(Kind kind, Field field, uint64_t n) {
+  Block* block = current ? current : attach();
+  if (block) {
+    std::atomic<uint64_t>& counter =
+        block->counters[static_cast<size_t>(kind)][field];
+    counter.store(counter.load(std::memory_order_relaxed) + n,
+                  std::memory_order_relaxed);
+  } else {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired[static_cast<size_t>(kind)][field] += n;
+  }
+}
+}  // namespace internal
+
+// Sums the blocks of every thread; the counters of threads still running may
+// be a few updates behind.
+inline Snapshot snapshot() {
+  internal::Registry& r = internal::registry();
+  internal::Totals totals;
+  {
+    std::lock_guard<std::mutex> lock(r.mutex);
+    totals = r.retired;
+    for (internal::Block* block = r.blocks; block; block = block->next) {
+      for (size_t k = 0; k < kKindCount; ++k) {
+        for (size_t f = 0; f < internal::kFieldCount; ++f) {
+          totals[k][f] +=
+              block->counters[k][f].load(std::memory_order_relaxed) -
+              block->baseline[k][f];
+        }
+      }
+    }
+  }
+  Snapshot result;
+  for (size_t k = 0; k < kKindCount; ++k) {
+    const auto& from = totals[k];
+    Counters& to = result.kinds[k];
+    to.allocations = from[internal::kAllocations];
+    to.frees = from[internal::kFrees];
+    to.bytes_allocated = from[internal::kBytesAllocated];
+    to.bytes_freed = from[internal::kBytesFreed];
+    to.reallocations = from[internal::kReallocations];
+    to.copies = from[internal::kCopies];
+    to.moves = from[internal::kMoves];
+    to.lookups = from[internal::kLookups];
+    to.comparisons = from[internal::kComparisons];
+  }
+  return result;
+}
+
+// Blocks are never written by another thread: a reset only moves their
+// baselines up to the current counts.
+inline void reset() {
+  internal::Registry& r = internal::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.retired = {};
+  for (internal::Block* block = r.blocks; block; block = block->next) {
+    for (size_t k = 0; k < kKindCount; ++k) {
+      for (size_t f = 0; f < internal::kFieldCount; ++f) {
+        block->baseline[k][f] =
+            block->counters[k][f].load(std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+// Hooks called by the containers
+inline void on_allocate([[maybe_unused]] Kind kind,
+                        [[maybe_unused]] size_t bytes) {
+  if constexpr (kEnabled) {
+    internal::add(kind, internal::kAllocations, 1);
+    internal::add(kind, internal::kBytesAllocated, bytes);
+  }
+}
+
+inline void on_free([[maybe_unused]] Kind kind,
+                    [[maybe_unused]] size_t bytes) {
+  if constexpr (kEnabled) {
+    internal::add(kind, internal::kFrees, 1);
+    internal::add(kind, internal::kBytesFreed, bytes);
+  }
+}
+
+inline void on_reallocate([[maybe_unused]] Kind kind) {
+  if constexpr (kEnabled) internal::add(kind, internal::kReallocations, 1);
+}
+
+inline void on_copy([[maybe_unused]] Kind kind,
+                    [[maybe_unused]] size_t n = 1) {
+  if constexpr (kEnabled) {
+    if (n) internal::add(kind, internal::kCopies, n);
+  }
+}
+
+inline void on_move([[maybe_unused]] Kind kind,
+                    [[maybe_unused]] size_t n = 1) {
+  if constexpr (kEnabled) {
+    if (n) internal::add(kind, internal::kMoves, n);
+  }
+}
+
+// An element built from Args: a single T argument is a copy or a move, any
+// other arguments construct it in place and are not counted
+template <typename T, typename... Args>
+void on_construct([[maybe_unused]] Kind kind, [[maybe_unused]] size_t n = 1) {
+  if constexpr (sizeof...(Args) == 1 &&
+                (std::is_same_v<std::decay_t<Args>, T> && ...)) {
+    if constexpr ((std::is_lvalue_reference_v<Args> && ...)) {
+      on_copy(kind, n);
+    } else {
+      on_move(kind, n);
+    }
+  }
+}
+
+// count elements relocated by memcpy, move or copy, whichever the container
+// picks for T
+template <typename T>
+void on_transfer([[maybe_unused]] Kind kind, [[maybe_unused]] size_t n) {
+  if constexpr (std::is_trivially_copyable_v<T> ||
+                std::is_nothrow_move_constructible_v<T> ||
+                !std::is_copy_constructible_v<T>) {
+    on_move(kind, n);
+  } else {
+    on_copy(kind, n);
+  }
+}
+
+// one descent of the tree that compared the key comparisons times
+inline void on_lookup([[maybe_unused]] Kind kind,
+                      [[maybe_unused]] size_t comparisons) {
+  if constexpr (kEnabled) {
+    internal::add(kind, internal::kLookups, 1);
+    internal::add(kind, internal::kComparisons, comparisons);
+  }
+}
+
+// comparisons that finish a lookup already counted
+inline void on_compare([[maybe_unused]] Kind kind,
+                       [[maybe_unused]] size_t comparisons = 1) {
+  if constexpr (kEnabled) {
+    internal::add(kind, internal::kComparisons, comparisons);
+  }
+}
+}  // namespace stats
+}  // namespace s21
+
+#endif  // SRC_S21_STATS_H_
@@ -0,0 +1,229 @@
+#ifndef SRC_S21_THREAD_POOL_H_
+#define SRC_S21_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+#include "s21_concurrent_queue.h"
+#include "s21_helpsrc.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Fork/join thread pool. Every worker owns a WorkStealingDeque of tasks:
+// parallel_invoke pushes the forked calls onto the deque of the worker
+// running it and idle workers steal them from the top, so the oldest and
+// usually largest pieces of a recursive split are the ones that travel.
+// Calls from threads outside the pool go through a shared ConcurrentQueue
+// instead.
+//
+// A thread waiting for its forked calls never blocks: it keeps running its
+// own tasks and stealing others until they are done, so nesting
+// parallel_invoke as deep as a recursion goes cannot deadlock. Workers that
+// find nothing to do sleep until new tasks are published.
+//
+// Since the thread calling parallel_invoke runs tasks too, a pool of k
+// workers keeps k + 1 threads busy. The default leaves one core for the
+// caller; a pool of 0 workers runs everything on the calling thread.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t threads = default_thread_count())
+      : worker_count_(threads),
+        workers_(new Worker[worker_count_]) {
+    for (size_t i = 0; i < worker_count_; ++i) {
+      workers_[i].pool = this;
+      workers_[i].seed = i * 0x9E3779B97F4A7C15u + 1;
+    }
+    for (size_t i = 0; i < worker_count_; ++i) {
+      workers_[i].thread = std::thread([this, i] { run_worker(workers_[i]); });
+    }
+  }
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  // waits for the workers; no parallel_invoke may still be running
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (size_t i = 0; i < worker_count_; ++i) workers_[i].thread.join();
+  }
+
+  size_t thread_count() const { return worker_count_; }
+
+  // one worker per core besides the caller, and at least one
+  static size_t default_thread_count() {
+    return std::max(2u, std::thread::hardware_concurrency()) - 1;
+  }
+
+  // Runs every call, the first one on this thread and the others wherever
+  // they get stolen, and returns once all of them have. The first exception
+  // thrown is rethrown here after the rest have finished.
+  template <class F, class... Rest>
+  void parallel_invoke(F&& first, Rest&&... rest) {
+    if constexpr (sizeof...(Rest) == 0) {
+      first();
+    } else {
+      std::tuple<Job<std::remove_reference_t<Rest>>...> jobs{rest...};
+      std::apply([this](auto&... job) { (fork(job), ...); }, jobs);
+      notify();
+      std::exception_ptr error;
+      try {
+        first();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::apply([this](auto&... job) { (join(job), ...); }, jobs);
+      std::apply(
+          [&error](auto&... job) {
+            ((error = error ? error : job.error), ...);
+          },
+          jobs);
+      if (error) std::rethrow_exception(error);
+    }
+  }
+
+ private:
+  static constexpr size_t kInjectCapacity = 1024;
+  static constexpr int kSpinsBeforeSleep = 64;
+
+  struct Task {
+    explicit Task(void (*call)(Task*)) : call(call) {}
+    void run() {
+      try {
+        call(this);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      done.store(true, std::memory_order_release);
+    }
+
+    void (*call)(Task*);
+    std::exception_ptr error;
+    std::atomic<bool> done{false};
+  };
+
+  template <class Fn>
+  struct Job : Task {
+    explicit Job(Fn& fn) : Task(&Job::invoke), fn(fn) {}
+    static void invoke(Task* task) { static_cast<Job*>(task)->fn(); }
+    Fn& fn;
+  };
+
+  struct Worker {
+    ThreadPool* pool = nullptr;
+    uint64_t seed = 1;  // xorshift state for picking victims
+    WorkStealingDeque<Task*> tasks;
+    std::thread thread;
+  };
+
+  const size_t worker_count_;
+  std::unique_ptr<Worker[]> workers_;
+  ConcurrentQueue<Task*> injected_{kInjectCapacity};
+  // sleeping workers wait for epoch_ to move; publishers only take the
+  // mutex when somebody sleeps
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<size_t> sleepers_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+
+  static Worker*& current_worker() {
+    static thread_local Worker* worker = nullptr;
+    return worker;
+  }
+  Worker* own_worker() const {
+    Worker* worker = current_worker();
+    return worker && worker->pool == this ? worker : nullptr;
+  }
+
+  void fork(Task& task) {
+    if (Worker* worker = own_worker()) {
+      worker->tasks.push(&task);
+    } else if (!injected_.try_push(&task)) {
+      task.run();  // the queue is full, so do it here
+    }
+  }
+
+  void join(Task& task) {
+    Worker* worker = own_worker();
+    while (!task.done.load(std::memory_order_acquire)) {
+      if (Task* other = find_task(worker)) {
+        other->run();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  // own deque first, then the outside queue, then another worker's deque
+  // starting from a random one
+  Task* find_task(Worker* worker) {
+    Task* task = nullptr;
+    if (worker && worker->tasks.try_pop(task)) return task;
+    if (injected_.try_pop(task)) return task;
+    size_t start = worker ? next_random(*worker) : 0;
+    for (size_t i = 0; i < worker_count_; ++i) {
+      Worker& victim = workers_[(start + i) % worker_count_];
+      if (&victim != worker && victim.tasks.try_steal(task)) return task;
+    }
+    return nullptr;
+  }
+
+  static size_t next_random(Worker& worker) {
+    worker.seed ^= worker.seed << 13;
+    worker.seed ^= worker.seed >> 7;
+    worker.seed ^= worker.seed << 17;
+    return static_cast<size_t>(worker.seed);
+  }
+
+  void notify() {
+    epoch_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      wake_.notify_all();
+    }
+  }
+
+  void run_worker(Worker& self) {
+    current_worker() = &self;
+    int idle = 0;
+    while (true) {
+      if (Task* task = find_task(&self)) {
+        task->run();
+        idle = 0;
+        continue;
+      }
+      if (++idle < kSpinsBeforeSleep) {
+        std::this_thread::yield();
+        continue;
+      }
+      // announce the sleep before the last look, so a publisher either
+      // sees the sleeper or its task is found here
+      sleepers_.fetch_add(1, std::memory_order_seq_cst);
+      uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+      Task* task = find_task(&self);
+      bool stopping = false;
+      if (!task) {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [&] {
+          return stop_ || epoch_.load(std::memory_order_seq_cst) != epoch;
+        });
+        stopping = stop_;
+      }
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+      idle = 0;
+      if (task) {
+        task->run();
+      } else if (stopping) {
+        return;
+      }
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_THREAD_POOL_H_
@@ -0,0 +1,1619 @@
+#ifndef SRC_S21_TREE_H_
+#define SRC_S21_TREE_H_
+
+#include <vector>
+
+#include "s21_helpsrc.h"
+#include "s21_stats.h"
+
+// Nodes keep the size of their subtree so that nth, rank and count_range run
+// in O(log n). Build with -DS21_TREE_SUBTREE_SIZE=0 to drop the field and its
+// upkeep; those queries then walk the elements instead.
+#ifndef S21_TREE_SUBTREE_SIZE
+#define S21_TREE_SUBTREE_SIZE 1
+#endif
+
+namespace s21 {
+// Key extractors: the tree orders nodes by KeyOfValue()(node->value)
+template <typename T>
+struct KeyIdentity {
+  const T& operator()(const T& value) const { return value; }
+};
+
+template <typename Pair>
+struct KeySelectFirst {
+  const typename Pair::first_type& operator()(const Pair& value) const {
+    return value.first;
+  }
+};
+
+// Links shared by the nodes of a tree and by its header, which holds no
+// value and stands for end(). The header's parent is the root and the
+// root's parent is the header; its left and right point at the leftmost and
+// rightmost nodes, so begin() and --end() are a single load.
+struct TreeNodeBase {
+  TreeNodeBase* parent = nullptr;
+  TreeNodeBase* left = nullptr;
+  TreeNodeBase* right = nullptr;
+  bool red = true;  // a new node is always linked in red, the header stays red
+#if S21_TREE_SUBTREE_SIZE
+  size_t count = 1;  // nodes in the subtree rooted here
+#endif
+};
+
+// Shape of a tree as reported by debug_stats(). Depths count the links from
+// the root, which sits at depth 0; a lookup compares its key about once per
+// level it passes, so average_depth + 1 is the usual cost of a lookup.
+struct TreeDebugStats {
+  size_t node_count = 0;
+  size_t height = 0;  // levels, 0 for an empty tree
+  size_t max_depth = 0;
+  double average_depth = 0.0;
+  std::vector<size_t> depth_histogram;  // number of nodes at each depth
+  size_t bytes_used = 0;  // node storage, without allocator overhead
+};
+
+// Red-black tree used as the common engine of Set, Map and Multiset.
+// Keys are ordered with Compare, called once per level on the way down; an
+// equal key is recognised by one more call at the bottom instead of a test
+// at every node. No red node has a red child and every
+// root-to-leaf path holds the same number of black nodes, so the height stays
+// below 2 * log2(n + 1) whatever order the keys are inserted in.
+//
+// Nodes come from Alloc rebound to Node, so a std::pmr::polymorphic_allocator
+// puts the whole tree in one memory resource.
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<Value>>
+class Tree {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Alloc;
+  using NodeBase = TreeNodeBase;
+
+  struct Node : NodeBase {
+    value_type value;
+    Node(const value_type& v) : value(v){};
+    ~Node() = default;
+  };
+
+  // A single node pointer: end() is the header, so iterators need no
+  // pointer back to their tree and --end() works in every container.
+  class TreeIterator {
+   public:
+    using iterator = TreeIterator;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    TreeIterator(const NodeBase* node = nullptr)
+        : node_(const_cast<NodeBase*>(node)) {}
+    NodeBase* current() const { return node_; }
+    bool operator==(const iterator& other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const iterator& other) const {
+      return node_ != other.node_;
+    }
+    reference operator*() const { return static_cast<Node*>(node_)->value; }
+    pointer operator->() const { return &static_cast<Node*>(node_)->value; }
+    iterator& operator++() {
+      if (node_) node_ = successor(node_);
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator temp(*this);
+      ++(*this);
+      return temp;
+    }
+    iterator& operator--() {
+      if (node_) node_ = predecessor(node_);
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator temp(*this);
+      --(*this);
+      return temp;
+    }
+
+   protected:
+    NodeBase* node_ = nullptr;
+  };
+
+  class TreeConstIterator : public TreeIterator {
+   public:
+    using const_iterator = TreeConstIterator;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    TreeConstIterator(const NodeBase* node = nullptr) : TreeIterator(node) {}
+    TreeConstIterator(const TreeIterator& it) : TreeIterator(it) {}
+    reference operator*() const {
+      return static_cast<const Node*>(TreeIterator::node_)->value;
+    }
+    pointer operator->() const {
+      return &static_cast<const Node*>(TreeIterator::node_)->value;
+    }
+    const_iterator& operator++() {
+      TreeIterator::operator++();
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator temp(*this);
+      TreeIterator::operator++();
+      return temp;
+    }
+    const_iterator& operator--() {
+      TreeIterator::operator--();
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator temp(*this);
+      TreeIterator::operator--();
+      return temp;
+    }
+  };
+
+  using iterator = TreeIterator;
+  using const_iterator = TreeConstIterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using node_allocator =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  static constexpr stats::Kind kStats = stats::Kind::kTree;
+  static constexpr bool kNothrowMoveAssign =
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value;
+  // with an arena-style allocator, trees of trivially destructible values
+  // are torn down by dropping the root
+  static constexpr bool kSkipTeardown =
+      releases_in_bulk<node_allocator>::value &&
+      std::is_trivially_destructible_v<value_type>;
+  // R, only when Compare is transparent and lookups may take any Q
+  template <typename Q, typename R>
+  using if_transparent = std::enable_if_t<is_transparent<Compare, Q>::value, R>;
+
+  // Owns a node taken out of a tree, like the C++17 node handles, together
+  // with the allocator that has to free it. key() and mapped() exist for pair
+  // values, value() for the rest.
+  class TreeNodeHandle {
+   public:
+    TreeNodeHandle() = default;
+    TreeNodeHandle(TreeNodeHandle&& other) noexcept
+        : node_(other.node_), alloc_(std::move(other.alloc_)) {
+      other.node_ = nullptr;
+      other.alloc_.reset();
+    }
+    // allocators need not be assignable, so the one held is rebuilt
+    TreeNodeHandle& operator=(TreeNodeHandle&& other) noexcept {
+      if (this != &other) {
+        reset();
+        node_ = other.node_;
+        if (other.alloc_) alloc_.emplace(*other.alloc_);
+        other.node_ = nullptr;
+        other.alloc_.reset();
+      }
+      return *this;
+    }
+    ~TreeNodeHandle() { reset(); }
+
+    bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    value_type& value() const { return node_->value; }
+    // the key of a pair value is const inside the tree but may be changed
+    // while the node is out of it
+    template <typename P = value_type>
+    std::remove_const_t<typename P::first_type>& key() const {
+      return const_cast<std::remove_const_t<typename P::first_type>&>(
+          node_->value.first);
+    }
+    template <typename P = value_type>
+    typename P::second_type& mapped() const {
+      return node_->value.second;
+    }
+    void swap(TreeNodeHandle& other) noexcept {
+      TreeNodeHandle tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+
+   private:
+    friend class Tree;
+    Node* node_ = nullptr;
+    std::optional<node_allocator> alloc_;
+
+    TreeNodeHandle(Node* node, const node_allocator& alloc) : node_(node) {
+      if (node_) alloc_.emplace(alloc);
+    }
+    Node* release() {
+      Node* node = node_;
+      node_ = nullptr;
+      alloc_.reset();
+      return node;
+    }
+    void reset() noexcept {
+      if (node_) destroy_node(*alloc_, node_);
+      node_ = nullptr;
+      alloc_.reset();
+    }
+  };
+
+  using node_type = TreeNodeHandle;
+
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
+  Tree();
+  explicit Tree(const allocator_type& alloc);
+  explicit Tree(const key_compare& comp,
+                const allocator_type& alloc = allocator_type());
+  Tree(const Tree& other);
+  Tree(Tree&& other) noexcept;
+  ~Tree();
+  Tree& operator=(const Tree& other);
+  Tree& operator=(Tree&& other) noexcept(kNothrowMoveAssign);
+
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+  reverse_iterator rbegin();
+  const_reverse_iterator rbegin() const;
+  reverse_iterator rend();
+  const_reverse_iterator rend() const;
+  bool empty() const;
+  size_type size() const;
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
+  void clear() noexcept;
+  void swap(Tree& other) noexcept;
+
+  // inserts value unless an equal key is present
+  std::pair<iterator, bool> insert_unique(const value_type& value);
+  // inserts value after all elements with an equal key
+  iterator insert_equal(const value_type& value);
+  // inserts value unless an equal key is present, as close as possible
+  // before hint; a hint that is right skips the descent from the root
+  iterator insert_unique(const_iterator hint, const value_type& value);
+  // replaces the contents with [first, last); a range sorted by key (and
+  // free of equal keys when unique) is built as a balanced tree in O(n),
+  // anything else is inserted element by element
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool unique);
+  void erase(iterator pos);  // unlinks, rebalances and frees the node at pos
+
+  // Node handles: extract unlinks a node without freeing it and the node
+  // insert overloads link it into this or another tree as it is.
+  node_type extract(const_iterator pos);
+  node_type extract(const key_type& key);  // first node with key, if any
+  insert_return_type insert_unique(node_type&& handle);
+  iterator insert_equal(node_type&& handle);
+  // move the nodes of other over; merge_unique leaves the keys already
+  // present here in other
+  void merge_unique(Tree& other);
+  void merge_equal(Tree& other);
+
+  iterator find(const key_type& key);
+  const_iterator find(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  size_type count(const key_type& key) const;
+  iterator lower_bound(const key_type& key);
+  const_iterator lower_bound(const key_type& key) const;
+  iterator upper_bound(const key_type& key);
+  const_iterator upper_bound(const key_type& key) const;
+  std::pair<iterator, iterator> equal_range(const key_type& key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type& key) const;
+  iterator nth(size_type k);  // k-th element in order, end() if k >= size
+  const_iterator nth(size_type k) const;
+
+  // The same lookups for keys of another type, with a transparent Compare
+  // only: a std::string_view finds std::string keys without a temporary.
+  template <typename Q>
+  if_transparent<Q, iterator> find(const Q& key) {
+    return iterator(or_end(find_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, const_iterator> find(const Q& key) const {
+    return const_iterator(or_end(find_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, bool> contains(const Q& key) const {
+    return find_node(key) != nullptr;
+  }
+  template <typename Q>
+  if_transparent<Q, size_type> count(const Q& key) const {
+    return count_nodes(key);
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> lower_bound(const Q& key) {
+    return iterator(or_end(lower_bound_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, const_iterator> lower_bound(const Q& key) const {
+    return const_iterator(or_end(lower_bound_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, iterator> upper_bound(const Q& key) {
+    return iterator(or_end(upper_bound_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, const_iterator> upper_bound(const Q& key) const {
+    return const_iterator(or_end(upper_bound_node(key)));
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<iterator, iterator>> equal_range(const Q& key) {
+    auto nodes = equal_range_nodes(key);
+    return {iterator(or_end(nodes.first)), iterator(or_end(nodes.second))};
+  }
+  template <typename Q>
+  if_transparent<Q, std::pair<const_iterator, const_iterator>> equal_range(
+      const Q& key) const {
+    auto nodes = equal_range_nodes(key);
+    return {const_iterator(or_end(nodes.first)),
+            const_iterator(or_end(nodes.second))};
+  }
+
+  // The node lookups return null where the iterator ones return end().
+  template <typename Q>
+  Node* lower_bound_node(const Q& key) const;  // first key >= key
+  template <typename Q>
+  Node* upper_bound_node(const Q& key) const;  // first key > key
+  Node* nth_node(size_type k) const;  // k-th node in order, null if k >= size
+  template <typename Q>
+  size_type rank(const Q& key) const;  // number of keys < key
+  // number of keys in [lo, hi)
+  size_type count_range(const key_type& lo, const key_type& hi) const;
+  const Node* root() const;
+
+  TreeDebugStats debug_stats() const;  // visits every node
+  // Average depth of samples nodes spread evenly over the key order, cheap
+  // enough to export as a metric: O(samples * log n) with subtree sizes and
+  // a walk over the elements without them.
+  double sampled_depth(size_type samples = 64) const;
+
+  static NodeBase* minimum(NodeBase* node);
+  static NodeBase* maximum(NodeBase* node);
+  static NodeBase* successor(NodeBase* node);
+  static NodeBase* predecessor(NodeBase* node);
+
+ private:
+  NodeBase header_;
+  size_type size_ = 0;
+  key_compare comp_;
+  node_allocator alloc_;
+
+  static const key_type& key_of(const NodeBase* node);
+  static bool is_red(const NodeBase* node);
+  static size_type subtree_size(const NodeBase* node);
+  static void update_size(NodeBase* node);
+  NodeBase* end_node() const;
+  NodeBase* or_end(NodeBase* node) const;  // end_node() for null
+  void reset_header() noexcept;
+  void set_root(NodeBase* root) noexcept;  // also finds the two ends
+  void swap_nodes(Tree& other) noexcept;
+  size_type depth_of(const NodeBase* node) const;
+  template <typename Q>
+  size_type rank_upper(const Q& key) const;  // number of keys <= key
+  template <typename Q>
+  size_type count_nodes(const Q& key) const;
+  template <typename Q>
+  Node* find_node(const Q& key) const;
+  Node* unique_slot(const key_type& key, NodeBase*& parent,
+                    bool& as_left) const;
+  void equal_slot(const key_type& key, NodeBase*& parent, bool& as_left) const;
+  void unlink(NodeBase* node);
+  NodeBase* take(Tree& other, NodeBase* node);
+  Node* adopt(node_type& handle);
+  Node* create_node(const value_type& value);
+  static void destroy_node(node_allocator& alloc, Node* node) noexcept;
+  template <typename Q>
+  std::pair<Node*, Node*> equal_range_nodes(const Q& key) const;
+  NodeBase* copy(const NodeBase* node, NodeBase* parent);
+  template <typename ForwardIt>
+  NodeBase* build_sorted(ForwardIt& first, size_type n, size_type depth,
+                         size_type red_depth);
+  void destroy(NodeBase* node) noexcept;
+  NodeBase* link(NodeBase* node, NodeBase* parent, bool as_left);
+  void rotate_left(NodeBase* node);
+  void rotate_right(NodeBase* node);
+  void transplant(NodeBase* u, NodeBase* v);
+  void insert_fixup(NodeBase* node);
+  void erase_fixup(NodeBase* node, NodeBase* parent);
+};
+
+//--------------------------------------------------------------------
+// Implementation
+//--------------------------------------------------------------------
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::Tree() : Tree(key_compare()) {}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::Tree(const allocator_type& alloc)
+    : Tree(key_compare(), alloc) {}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::Tree(const key_compare& comp,
+                            const allocator_type& alloc)
+    : size_(0), comp_(comp), alloc_(alloc) {
+  reset_header();
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::Tree(const Tree& other)
+    : Tree(other.comp_,
+           node_traits::select_on_container_copy_construction(other.alloc_)) {
+  set_root(copy(other.header_.parent, &header_));
+  size_ = other.size_;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::Tree(Tree&& other) noexcept
+    : size_(0), comp_(other.comp_), alloc_(other.alloc_) {
+  reset_header();
+  swap_nodes(other);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>::~Tree() {
+  destroy(header_.parent);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>& Tree<K, V, KoV, C, A>::operator=(const Tree& other) {
+  if (this != &other) {
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+      if (!(alloc_ == other.alloc_)) clear();
+      alloc_ = other.alloc_;
+    }
+    // the copy is made with our allocator before the old nodes go
+    Tree tmp(other.comp_, get_allocator());
+    tmp.set_root(tmp.copy(other.header_.parent, &tmp.header_));
+    tmp.size_ = other.size_;
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Nodes of a tree with another, non-propagating allocator cannot be taken
+// over, so its values are copied instead.
+template <typename K, typename V, typename KoV, typename C, typename A>
+Tree<K, V, KoV, C, A>& Tree<K, V, KoV, C, A>::operator=(Tree&& other) noexcept(
+    kNothrowMoveAssign) {
+  if (this != &other) {
+    clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      alloc_ = other.alloc_;
+    } else if (!(alloc_ == other.alloc_)) {
+      *this = static_cast<const Tree&>(other);
+      other.clear();
+      return *this;
+    }
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::begin() {
+  return iterator(header_.left);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator
+Tree<K, V, KoV, C, A>::begin() const {
+  return const_iterator(header_.left);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::end() {
+  return iterator(&header_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator
+Tree<K, V, KoV, C, A>::end() const {
+  return const_iterator(&header_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::reverse_iterator
+Tree<K, V, KoV, C, A>::rbegin() {
+  return reverse_iterator(end());
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_reverse_iterator
+Tree<K, V, KoV, C, A>::rbegin() const {
+  return const_reverse_iterator(end());
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::reverse_iterator
+Tree<K, V, KoV, C, A>::rend() {
+  return reverse_iterator(begin());
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_reverse_iterator
+Tree<K, V, KoV, C, A>::rend() const {
+  return const_reverse_iterator(begin());
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+bool Tree<K, V, KoV, C, A>::empty() const {
+  return size_ == 0;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::size() const {
+  return size_;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::allocator_type
+Tree<K, V, KoV, C, A>::get_allocator()
+    const {
+  return allocator_type(alloc_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::key_compare Tree<K, V, KoV, C, A>::key_comp()
+    const {
+  return comp_;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::clear() noexcept {
+  destroy(header_.parent);
+  reset_header();
+  size_ = 0;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::swap(Tree& other) noexcept {
+  swap_nodes(other);
+  std::swap(comp_, other.comp_);
+  swap_allocators(alloc_, other.alloc_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+std::pair<typename Tree<K, V, KoV, C, A>::iterator, bool>
+Tree<K, V, KoV, C, A>::insert_unique(const value_type& value) {
+  NodeBase* parent;
+  bool as_left;
+  if (Node* equal = unique_slot(KoV()(value), parent, as_left)) {
+    return std::make_pair(iterator(equal), false);
+  }
+  NodeBase* new_node = link(create_node(value), parent, as_left);
+  return std::make_pair(iterator(new_node), true);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::insert_equal(
+    const value_type& value) {
+  NodeBase* parent;
+  bool as_left;
+  equal_slot(KoV()(value), parent, as_left);
+  return iterator(link(create_node(value), parent, as_left));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::node_type Tree<K, V, KoV, C, A>::extract(
+    const_iterator pos) {
+  NodeBase* node = pos.current();
+  if (!node || node == &header_) return node_type();
+  unlink(node);
+  return node_type(static_cast<Node*>(node), alloc_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::node_type Tree<K, V, KoV, C, A>::extract(
+    const key_type& key) {
+  return extract(const_iterator(find_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::insert_return_type
+Tree<K, V, KoV, C, A>::insert_unique(node_type&& handle) {
+  if (handle.empty()) return {end(), false, node_type()};
+  NodeBase* parent;
+  bool as_left;
+  if (Node* equal = unique_slot(key_of(handle.node_), parent, as_left)) {
+    return {iterator(equal), false, std::move(handle)};
+  }
+  NodeBase* node = link(adopt(handle), parent, as_left);
+  return {iterator(node), true, node_type()};
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::insert_equal(
+    node_type&& handle) {
+  if (handle.empty()) return end();
+  NodeBase* parent;
+  bool as_left;
+  equal_slot(key_of(handle.node_), parent, as_left);
+  return iterator(link(adopt(handle), parent, as_left));
+}
+
+// Both merges relink the nodes of other, nothing is allocated or copied
+// unless the two trees use different allocators.
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::merge_unique(Tree& other) {
+  if (this == &other) return;
+  for (NodeBase* node = other.header_.left; node != &other.header_;) {
+    NodeBase* next = successor(node);
+    NodeBase* parent;
+    bool as_left;
+    if (!unique_slot(key_of(node), parent, as_left)) {
+      link(take(other, node), parent, as_left);
+    }
+    node = next;
+  }
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::merge_equal(Tree& other) {
+  if (this == &other) return;
+  for (NodeBase* node = other.header_.left; node != &other.header_;) {
+    NodeBase* next = successor(node);
+    NodeBase* parent;
+    bool as_left;
+    equal_slot(key_of(node), parent, as_left);
+    link(take(other, node), parent, as_left);
+    node = next;
+  }
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::insert_unique(
+    const_iterator hint, const value_type& value) {
+  const key_type& key = KoV()(value);
+  NodeBase* pos = hint.current();
+  if (!header_.parent) return insert_unique(value).first;
+  size_t compared = 0;
+  auto less = [this, &compared](const key_type& a, const key_type& b) {
+    ++compared;
+    return comp_(a, b);
+  };
+  NodeBase* parent = nullptr;
+  bool as_left = false;
+  if (!pos || pos == &header_) {
+    // appending in key order, the usual case for a sorted load
+    NodeBase* last = header_.right;
+    if (less(key_of(last), key)) parent = last;
+  } else if (less(key, key_of(pos))) {
+    NodeBase* before = pos == header_.left ? nullptr : predecessor(pos);
+    if (!before || less(key_of(before), key)) {
+      // with a left subtree, before is its maximum and has no right child
+      parent = pos->left ? before : pos;
+      as_left = !pos->left;
+    }
+  } else if (less(key_of(pos), key)) {
+    NodeBase* after = successor(pos);
+    if (after == &header_ || less(key, key_of(after))) {
+      parent = pos->right ? after : pos;
+      as_left = pos->right != nullptr;
+    }
+  } else {
+    stats::on_compare(kStats, compared);
+    return iterator(pos);
+  }
+  stats::on_compare(kStats, compared);
+  if (parent) return iterator(link(create_node(value), parent, as_left));
+  // a wrong hint; the plain insert counts its own descent
+  return insert_unique(value).first;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename ForwardIt>
+void Tree<K, V, KoV, C, A>::assign_sorted(ForwardIt first, ForwardIt last,
+                                          bool unique) {
+  size_t compared = 0;
+  auto out_of_order = [this, unique, &compared](const value_type& a,
+                                                const value_type& b) {
+    ++compared;
+    return unique ? !comp_(KoV()(a), KoV()(b)) : comp_(KoV()(b), KoV()(a));
+  };
+  Tree tmp(comp_, get_allocator());
+  bool sorted = std::adjacent_find(first, last, out_of_order) == last;
+  stats::on_compare(kStats, compared);
+  if (sorted) {
+    size_type n = std::distance(first, last);
+    // the levels above the deepest one are full, so colouring only the
+    // deepest level red gives every path the same black height
+    size_type red_depth = 0;
+    for (size_type full = 1; full < n; full = 2 * full + 1) ++red_depth;
+    NodeBase* root = tmp.build_sorted(first, n, 0, red_depth);
+    if (root) root->red = false;
+    tmp.set_root(root);
+    tmp.size_ = n;
+  } else if (unique) {
+    for (; first != last; ++first) tmp.insert_unique(*first);
+  } else {
+    for (; first != last; ++first) tmp.insert_equal(*first);
+  }
+  swap(tmp);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::erase(iterator pos) {
+  NodeBase* node = pos.current();
+  if (!node || node == &header_) return;
+  unlink(node);
+  destroy_node(alloc_, static_cast<Node*>(node));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::unique_slot(
+    const key_type& key, NodeBase*& parent, bool& as_left) const {
+  parent = end_node();
+  as_left = true;
+  NodeBase* lower = nullptr;  // the last node whose key is not less than key
+  size_t compared = 0;
+  for (NodeBase* node = header_.parent; node; ++compared) {
+    parent = node;
+    as_left = !comp_(key_of(node), key);
+    if (as_left) lower = node;
+    node = as_left ? node->left : node->right;
+  }
+  stats::on_lookup(kStats, compared + (lower != nullptr));
+  // lower holds the smallest key not less than key, equal to it or greater
+  if (lower && !comp_(key, key_of(lower))) return static_cast<Node*>(lower);
+  return nullptr;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::equal_slot(const key_type& key, NodeBase*& parent,
+                                       bool& as_left) const {
+  parent = end_node();
+  as_left = true;
+  size_t compared = 0;
+  for (NodeBase* node = header_.parent; node; ++compared) {
+    parent = node;
+    as_left = comp_(key, key_of(node));
+    node = as_left ? node->left : node->right;
+  }
+  stats::on_lookup(kStats, compared);
+}
+
+// Takes node out of the tree and rebalances, leaving it detached and ready
+// to be linked again.
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::unlink(NodeBase* node) {
+  // the cached ends move to the neighbours of node while its links hold;
+  // the leftmost node has no left child, so its successor is either the
+  // minimum of its right subtree or its parent, and the other way round
+  if (node == header_.left) {
+    header_.left = node->right ? minimum(node->right) : node->parent;
+  }
+  if (node == header_.right) {
+    header_.right = node->left ? maximum(node->left) : node->parent;
+  }
+  NodeBase* removed = node;  // node that actually leaves its place in the tree
+  bool removed_red = removed->red;
+  NodeBase* child = nullptr;
+  NodeBase* child_parent = nullptr;
+  if (!node->left) {
+    child = node->right;
+    child_parent = node->parent;
+    transplant(node, node->right);
+  } else if (!node->right) {
+    child = node->left;
+    child_parent = node->parent;
+    transplant(node, node->left);
+  } else {
+    removed = minimum(node->right);
+    removed_red = removed->red;
+    child = removed->right;
+    if (removed->parent == node) {
+      child_parent = removed;
+    } else {
+      child_parent = removed->parent;
+      transplant(removed, removed->right);
+      removed->right = node->right;
+      removed->right->parent = removed;
+    }
+    transplant(node, removed);
+    removed->left = node->left;
+    removed->left->parent = removed;
+    removed->red = node->red;
+#if S21_TREE_SUBTREE_SIZE
+    removed->count = node->count;
+#endif
+  }
+#if S21_TREE_SUBTREE_SIZE
+  // every node above the vacated spot lost one descendant
+  for (NodeBase* up = child_parent; up != &header_; up = up->parent) {
+    --up->count;
+  }
+#endif
+  --size_;
+  if (!removed_red) erase_fixup(child, child_parent);
+  node->parent = node->left = node->right = nullptr;
+  node->red = true;
+#if S21_TREE_SUBTREE_SIZE
+  node->count = 1;
+#endif
+}
+
+// Detaches node from other so it can be linked here. A node can only move to
+// a tree with an equal allocator; otherwise a copy is made and other frees
+// the original.
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::take(
+    Tree& other, NodeBase* node) {
+  if (alloc_ == other.alloc_) {
+    other.unlink(node);
+    return node;
+  }
+  Node* copy = create_node(static_cast<Node*>(node)->value);
+  other.unlink(node);
+  destroy_node(other.alloc_, static_cast<Node*>(node));
+  return copy;
+}
+
+// the same for a node held by a handle, which is left empty
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::adopt(
+    node_type& handle) {
+  if (*handle.alloc_ == alloc_) return handle.release();
+  Node* copy = create_node(handle.node_->value);
+  handle.reset();
+  return copy;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::create_node(
+    const value_type& value) {
+  Node* node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, value);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  stats::on_allocate(kStats, sizeof(Node));
+  stats::on_copy(kStats);
+  return node;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::destroy_node(node_allocator& alloc,
+                                         Node* node) noexcept {
+  node_traits::destroy(alloc, node);
+  node_traits::deallocate(alloc, node, 1);
+  stats::on_free(kStats, sizeof(Node));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::find(
+    const key_type& key) {
+  return iterator(or_end(find_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator Tree<K, V, KoV, C, A>::find(
+    const key_type& key) const {
+  return const_iterator(or_end(find_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+bool Tree<K, V, KoV, C, A>::contains(const key_type& key) const {
+  return find_node(key) != nullptr;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::count(
+    const key_type& key) const {
+  return count_nodes(key);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::lower_bound(
+    const key_type& key) {
+  return iterator(or_end(lower_bound_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator
+Tree<K, V, KoV, C, A>::lower_bound(const key_type& key) const {
+  return const_iterator(or_end(lower_bound_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::upper_bound(
+    const key_type& key) {
+  return iterator(or_end(upper_bound_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator
+Tree<K, V, KoV, C, A>::upper_bound(const key_type& key) const {
+  return const_iterator(or_end(upper_bound_node(key)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+std::pair<typename Tree<K, V, KoV, C, A>::iterator,
+          typename Tree<K, V, KoV, C, A>::iterator>
+Tree<K, V, KoV, C, A>::equal_range(const key_type& key) {
+  auto nodes = equal_range_nodes(key);
+  return {iterator(or_end(nodes.first)), iterator(or_end(nodes.second))};
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+std::pair<typename Tree<K, V, KoV, C, A>::const_iterator,
+          typename Tree<K, V, KoV, C, A>::const_iterator>
+Tree<K, V, KoV, C, A>::equal_range(const key_type& key) const {
+  auto nodes = equal_range_nodes(key);
+  return {const_iterator(or_end(nodes.first)),
+          const_iterator(or_end(nodes.second))};
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::iterator Tree<K, V, KoV, C, A>::nth(
+    size_type k) {
+  return iterator(or_end(nth_node(k)));
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::const_iterator Tree<K, V, KoV, C, A>::nth(
+    size_type k) const {
+  return const_iterator(or_end(nth_node(k)));
+}
+
+// Preorder walk through the parent pointers, so a degenerate tree does not
+// take the stack with it
+template <typename K, typename V, typename KoV, typename C, typename A>
+TreeDebugStats Tree<K, V, KoV, C, A>::debug_stats() const {
+  TreeDebugStats result;
+  result.node_count = size_;
+  result.bytes_used = size_ * sizeof(Node);
+  size_type total = 0;
+  size_type depth = 0;
+  const NodeBase* node = header_.parent;
+  while (node) {
+    if (result.depth_histogram.size() <= depth) {
+      result.depth_histogram.push_back(0);
+    }
+    ++result.depth_histogram[depth];
+    total += depth;
+    if (node->left || node->right) {
+      node = node->left ? node->left : node->right;
+      ++depth;
+      continue;
+    }
+    // climb to the nearest ancestor with a right subtree not yet visited
+    const NodeBase* from = node;
+    for (node = node->parent; node != &header_;
+         from = node, node = node->parent, --depth) {
+      if (node->right && node->right != from) break;
+    }
+    node = node == &header_ ? nullptr : node->right;
+  }
+  result.height = result.depth_histogram.size();
+  result.max_depth = result.height ? result.height - 1 : 0;
+  if (size_) result.average_depth = static_cast<double>(total) / size_;
+  return result;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+double Tree<K, V, KoV, C, A>::sampled_depth(size_type samples) const {
+  samples = std::min(samples, size_);
+  if (samples == 0) return 0.0;
+  size_type total = 0;
+  for (size_type i = 0; i < samples; ++i) {
+    // the middle of the i-th of samples equal runs of the order
+    total += depth_of(nth_node((2 * i + 1) * size_ / (2 * samples)));
+  }
+  return static_cast<double>(total) / samples;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::lower_bound_node(
+    const Q& key) const {
+  NodeBase* result = nullptr;
+  NodeBase* node = header_.parent;
+  size_t compared = 0;
+  for (; node; ++compared) {
+    if (comp_(key_of(node), key)) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
+  }
+  stats::on_lookup(kStats, compared);
+  return static_cast<Node*>(result);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::upper_bound_node(
+    const Q& key) const {
+  NodeBase* result = nullptr;
+  NodeBase* node = header_.parent;
+  size_t compared = 0;
+  for (; node; ++compared) {
+    if (comp_(key, key_of(node))) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  stats::on_lookup(kStats, compared);
+  return static_cast<Node*>(result);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::nth_node(
+    size_type k) const {
+#if S21_TREE_SUBTREE_SIZE
+  NodeBase* node = header_.parent;
+  while (node) {
+    size_type left = subtree_size(node->left);
+    if (k < left) {
+      node = node->left;
+    } else if (k == left) {
+      return static_cast<Node*>(node);
+    } else {
+      k -= left + 1;
+      node = node->right;
+    }
+  }
+  return nullptr;
+#else
+  if (k >= size_) return nullptr;
+  NodeBase* node = header_.left;
+  while (k--) node = successor(node);
+  return static_cast<Node*>(node);
+#endif
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::rank(
+    const Q& key) const {
+#if S21_TREE_SUBTREE_SIZE
+  size_type result = 0;
+  NodeBase* node = header_.parent;
+  while (node) {
+    if (comp_(key_of(node), key)) {
+      result += subtree_size(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return result;
+#else
+  size_type result = 0;
+  for (NodeBase* node = header_.left;
+       node != &header_ && comp_(key_of(node), key); node = successor(node)) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::count_range(
+    const key_type& lo, const key_type& hi) const {
+  if (!comp_(lo, hi)) return 0;
+#if S21_TREE_SUBTREE_SIZE
+  return rank(hi) - rank(lo);
+#else
+  size_type result = 0;
+  for (NodeBase* node = or_end(lower_bound_node(lo));
+       node != &header_ && comp_(key_of(node), hi); node = successor(node)) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+const
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::root() const {
+  return static_cast<const Node*>(header_.parent);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::minimum(
+    NodeBase* node) {
+  while (node && node->left) node = node->left;
+  return node;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::maximum(
+    NodeBase* node) {
+  while (node && node->right) node = node->right;
+  return node;
+}
+
+// From the rightmost node the climb runs up to the root and on to the
+// header. When the root is the rightmost node it goes one step further,
+// from the header back to the root, and the last check steps back.
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::successor(
+    NodeBase* node) {
+  if (node->right) return minimum(node->right);
+  NodeBase* parent = node->parent;
+  while (parent && node == parent->right) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent && node->right == parent ? node : parent;
+}
+
+// The header is the one red node that is its own grandparent; stepping back
+// from it lands on the rightmost node.
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::predecessor(
+    NodeBase* node) {
+  if (node->red && node->parent && node->parent->parent == node) {
+    return node->right;
+  }
+  if (node->left) return maximum(node->left);
+  NodeBase* parent = node->parent;
+  while (parent && node == parent->left) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent;
+}
+
+//--------------------------------------------------------------------
+// Implementation private
+//--------------------------------------------------------------------
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+const typename Tree<K, V, KoV, C, A>::key_type& Tree<K, V, KoV, C, A>::key_of(
+    const NodeBase* node) {
+  return KoV()(static_cast<const Node*>(node)->value);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+bool Tree<K, V, KoV, C, A>::is_red(const NodeBase* node) {
+  return node && node->red;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::subtree_size(
+    const NodeBase* node) {
+#if S21_TREE_SUBTREE_SIZE
+  return node ? node->count : 0;
+#else
+  (void)node;
+  return 0;
+#endif
+}
+
+// recomputes the subtree size of node from its children
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::update_size(NodeBase* node) {
+#if S21_TREE_SUBTREE_SIZE
+  node->count = 1 + subtree_size(node->left) + subtree_size(node->right);
+#else
+  (void)node;
+#endif
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::end_node()
+    const {
+  return const_cast<NodeBase*>(&header_);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::or_end(
+    NodeBase* node) const {
+  return node ? node : end_node();
+}
+
+// an empty tree's header has no root and is its own leftmost and rightmost
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::reset_header() noexcept {
+  header_.parent = nullptr;
+  header_.left = header_.right = &header_;
+  header_.red = true;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::set_root(NodeBase* root) noexcept {
+  if (!root) {
+    reset_header();
+    return;
+  }
+  header_.parent = root;
+  root->parent = &header_;
+  header_.left = minimum(root);
+  header_.right = maximum(root);
+}
+
+// swaps the nodes and sizes of the two trees; the roots are pointed back at
+// their new headers and an empty header at itself
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::swap_nodes(Tree& other) noexcept {
+  std::swap(header_.parent, other.header_.parent);
+  std::swap(header_.left, other.header_.left);
+  std::swap(header_.right, other.header_.right);
+  std::swap(size_, other.size_);
+  for (Tree* tree : {this, &other}) {
+    NodeBase& header = tree->header_;
+    if (header.parent) {
+      header.parent->parent = &header;
+    } else {
+      header.left = header.right = &header;
+    }
+  }
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::depth_of(
+    const NodeBase* node) const {
+  size_type depth = 0;
+  for (; node->parent != &header_; node = node->parent) ++depth;
+  return depth;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::rank_upper(
+    const Q& key) const {
+  size_type result = 0;
+  NodeBase* node = header_.parent;
+  while (node) {
+    if (comp_(key, key_of(node))) {
+      node = node->left;
+    } else {
+      result += subtree_size(node->left) + 1;
+      node = node->right;
+    }
+  }
+  return result;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::size_type Tree<K, V, KoV, C, A>::count_nodes(
+    const Q& key) const {
+#if S21_TREE_SUBTREE_SIZE
+  return rank_upper(key) - rank(key);
+#else
+  size_type result = 0;
+  for (NodeBase* node = or_end(lower_bound_node(key));
+       node != &header_ && !comp_(key, key_of(node)); node = successor(node)) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+// the lower bound is the only candidate, so the key is compared for
+// equality once instead of at every level
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+typename Tree<K, V, KoV, C, A>::Node* Tree<K, V, KoV, C, A>::find_node(
+    const Q& key) const {
+  Node* node = lower_bound_node(key);
+  if (!node) return nullptr;
+  stats::on_compare(kStats);
+  return !comp_(key, key_of(node)) ? node : nullptr;
+}
+
+// Descends to the first node with an equal key, then finishes the lower
+// bound in its left subtree and the upper bound in its right one.
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename Q>
+std::pair<typename Tree<K, V, KoV, C, A>::Node*,
+          typename Tree<K, V, KoV, C, A>::Node*>
+Tree<K, V, KoV, C, A>::equal_range_nodes(const Q& key) const {
+  NodeBase* upper = nullptr;
+  NodeBase* node = header_.parent;
+  size_t compared = 0;
+  while (node) {
+    ++compared;
+    if (comp_(key_of(node), key)) {
+      node = node->right;
+      continue;
+    }
+    ++compared;
+    if (comp_(key, key_of(node))) {
+      upper = node;
+      node = node->left;
+    } else {
+      NodeBase* lower = node;
+      for (NodeBase* left = node->left; left; ++compared) {
+        if (comp_(key_of(left), key)) {
+          left = left->right;
+        } else {
+          lower = left;
+          left = left->left;
+        }
+      }
+      for (NodeBase* right = node->right; right; ++compared) {
+        if (comp_(key, key_of(right))) {
+          upper = right;
+          right = right->left;
+        } else {
+          right = right->right;
+        }
+      }
+      stats::on_lookup(kStats, compared);
+      return {static_cast<Node*>(lower), static_cast<Node*>(upper)};
+    }
+  }
+  stats::on_lookup(kStats, compared);
+  return {static_cast<Node*>(upper), static_cast<Node*>(upper)};
+}
+
+// Copies the subtree in preorder without recursion: the walk climbs back
+// through the parent pointers of both trees, moving to the right child once
+// the left one has been copied.
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::copy(
+    const NodeBase* node, NodeBase* parent) {
+  if (!node) return nullptr;
+  auto clone = [this](const NodeBase* from, NodeBase* to_parent) {
+    Node* to = create_node(static_cast<const Node*>(from)->value);
+    to->red = from->red;
+#if S21_TREE_SUBTREE_SIZE
+    to->count = from->count;
+#endif
+    to->parent = to_parent;
+    return static_cast<NodeBase*>(to);
+  };
+  NodeBase* root = clone(node, parent);
+  const NodeBase* from = node;
+  NodeBase* to = root;
+  try {
+    for (;;) {
+      if (from->left && !to->left) {
+        from = from->left;
+        to = to->left = clone(from, to);
+      } else if (from->right && !to->right) {
+        from = from->right;
+        to = to->right = clone(from, to);
+      } else if (from != node) {
+        from = from->parent;
+        to = to->parent;
+      } else {
+        break;
+      }
+    }
+  } catch (...) {
+    destroy(root);  // the nodes copied so far form a proper subtree
+    throw;
+  }
+  return root;
+}
+
+// Builds the n elements starting at first into a subtree, middle element at
+// the top, consuming the range in order so that no random access is needed.
+template <typename K, typename V, typename KoV, typename C, typename A>
+template <typename ForwardIt>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::build_sorted(
+    ForwardIt& first, size_type n, size_type depth, size_type red_depth) {
+  if (n == 0) return nullptr;
+  size_type left_size = (n - 1) / 2;
+  NodeBase* left = build_sorted(first, left_size, depth + 1, red_depth);
+  NodeBase* node = nullptr;
+  try {
+    node = create_node(*first);
+  } catch (...) {
+    destroy(left);
+    throw;
+  }
+  ++first;
+  node->red = depth == red_depth;
+#if S21_TREE_SUBTREE_SIZE
+  node->count = n;
+#endif
+  node->left = left;
+  if (left) left->parent = node;
+  try {
+    node->right = build_sorted(first, n - 1 - left_size, depth + 1, red_depth);
+  } catch (...) {
+    destroy(node);
+    throw;
+  }
+  if (node->right) node->right->parent = node;
+  return node;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::destroy(NodeBase* node) noexcept {
+  // nothing to run per node and the allocator frees nothing either
+  if constexpr (kSkipTeardown) return;
+  // rotating every left child up turns the subtree into a right-leaning
+  // chain that is freed front to back, with no stack at all
+  while (node) {
+    if (NodeBase* left = node->left) {
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      NodeBase* next = node->right;
+      destroy_node(alloc_, static_cast<Node*>(node));
+      node = next;
+    }
+  }
+}
+
+// hangs node under parent, the header for the first node of an empty tree,
+// and moves the cached ends when it lands outside them
+template <typename K, typename V, typename KoV, typename C, typename A>
+typename Tree<K, V, KoV, C, A>::NodeBase* Tree<K, V, KoV, C, A>::link(
+    NodeBase* node, NodeBase* parent, bool as_left) {
+  node->parent = parent;
+  if (parent == &header_) {
+    header_.parent = header_.left = header_.right = node;
+  } else if (as_left) {
+    parent->left = node;
+    if (parent == header_.left) header_.left = node;
+  } else {
+    parent->right = node;
+    if (parent == header_.right) header_.right = node;
+  }
+  ++size_;
+#if S21_TREE_SUBTREE_SIZE
+  for (NodeBase* up = parent; up != &header_; up = up->parent) ++up->count;
+#endif
+  insert_fixup(node);
+  return node;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::rotate_left(NodeBase* node) {
+  NodeBase* pivot = node->right;
+  node->right = pivot->left;
+  if (pivot->left) pivot->left->parent = node;
+  transplant(node, pivot);
+  pivot->left = node;
+  node->parent = pivot;
+  update_size(node);
+  update_size(pivot);
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::rotate_right(NodeBase* node) {
+  NodeBase* pivot = node->left;
+  node->left = pivot->right;
+  if (pivot->right) pivot->right->parent = node;
+  transplant(node, pivot);
+  pivot->right = node;
+  node->parent = pivot;
+  update_size(node);
+  update_size(pivot);
+}
+
+// puts v in place of u as a child of u's parent; the root is the header's
+// parent, whatever the header's left and right say
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::transplant(NodeBase* u, NodeBase* v) {
+  if (u->parent == &header_) {
+    header_.parent = v;
+  } else if (u == u->parent->left) {
+    u->parent->left = v;
+  } else {
+    u->parent->right = v;
+  }
+  if (v) v->parent = u->parent;
+}
+
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::insert_fixup(NodeBase* node) {
+  while (node != header_.parent && node->parent->red) {
+    NodeBase* parent = node->parent;
+    NodeBase* grand = parent->parent;  // a red parent is never the root
+    if (parent == grand->left) {
+      NodeBase* uncle = grand->right;
+      if (is_red(uncle)) {
+        parent->red = uncle->red = false;
+        grand->red = true;
+        node = grand;
+      } else {
+        if (node == parent->right) {
+          rotate_left(parent);
+          std::swap(node, parent);
+        }
+        parent->red = false;
+        grand->red = true;
+        rotate_right(grand);
+      }
+    } else {
+      NodeBase* uncle = grand->left;
+      if (is_red(uncle)) {
+        parent->red = uncle->red = false;
+        grand->red = true;
+        node = grand;
+      } else {
+        if (node == parent->left) {
+          rotate_right(parent);
+          std::swap(node, parent);
+        }
+        parent->red = false;
+        grand->red = true;
+        rotate_left(grand);
+      }
+    }
+  }
+  header_.parent->red = false;
+}
+
+// node carries an extra black; it may be null, hence the explicit parent
+template <typename K, typename V, typename KoV, typename C, typename A>
+void Tree<K, V, KoV, C, A>::erase_fixup(NodeBase* node, NodeBase* parent) {
+  while (node != header_.parent && !is_red(node)) {
+    if (node == parent->left) {
+      NodeBase* sibling = parent->right;
+      if (sibling->red) {
+        sibling->red = false;
+        parent->red = true;
+        rotate_left(parent);
+        sibling = parent->right;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!is_red(sibling->right)) {
+          sibling->left->red = false;
+          sibling->red = true;
+          rotate_right(sibling);
+          sibling = parent->right;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        sibling->right->red = false;
+        rotate_left(parent);
+        node = header_.parent;
+      }
+    } else {
+      NodeBase* sibling = parent->left;
+      if (sibling->red) {
+        sibling->red = false;
+        parent->red = true;
+        rotate_right(parent);
+        sibling = parent->left;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!is_red(sibling->left)) {
+          sibling->right->red = false;
+          sibling->red = true;
+          rotate_left(sibling);
+          sibling = parent->left;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        sibling->left->red = false;
+        rotate_right(parent);
+        node = header_.parent;
+      }
+    }
+  }
+  if (node) node->red = false;
+}
+}  // namespace s21
+#endif  // SRC_S21_TREE_H_
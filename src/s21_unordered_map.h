@@ -0,0 +1,571 @@
+#ifndef SRC_S21_UNORDERED_MAP_H_
+#define SRC_S21_UNORDERED_MAP_H_
+
+#include <tuple>
+
+#include "s21_helpsrc.h"
+#include "s21_stats.h"
+#include "s21_vector.h"
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+#include <emmintrin.h>
+#define S21_HASH_SSE2 1
+#endif
+
+namespace s21 {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedMap;
+
+namespace hash_internal {
+// Every slot has a control byte: kEmpty for a never used slot, kDeleted for
+// an erased one and the low 7 bits of the hash (h2) for a full one, so only
+// full slots have the top bit clear.
+constexpr int8_t kEmpty = -128;
+constexpr int8_t kDeleted = -2;
+constexpr size_t kGroupWidth = 16;
+
+// Byte by byte matching of the control bytes of one probe group. Each match
+// returns a mask with bit i set when slot i of the group qualifies.
+class ScalarGroup {
+ public:
+  explicit ScalarGroup(const int8_t* ctrl) : ctrl_(ctrl) {}
+  uint32_t match(int8_t h2) const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+    }
+    return mask;
+  }
+  uint32_t match_empty() const { return match(kEmpty); }
+  uint32_t match_empty_or_deleted() const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[i] < 0) << i;
+    }
+    return mask;
+  }
+
+ private:
+  const int8_t* ctrl_;
+};
+
+#ifdef S21_HASH_SSE2
+// The same matches on all 16 control bytes at once.
+class SseGroup {
+ public:
+  explicit SseGroup(const int8_t* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+  uint32_t match(int8_t h2) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+  uint32_t match_empty() const { return match(kEmpty); }
+  uint32_t match_empty_or_deleted() const {
+    return _mm_movemask_epi8(ctrl_);
+  }
+
+ private:
+  __m128i ctrl_;
+};
+using Group = SseGroup;
+#else
+using Group = ScalarGroup;
+#endif
+
+inline size_t lowest_bit(uint32_t mask) { return __builtin_ctz(mask); }
+
+// std::hash of an integer is the integer itself, so the bits are spread
+// before the high part picks the group and the low 7 bits become h2.
+inline size_t mix_hash(size_t hash) {
+  uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+  return static_cast<size_t>(h ^ (h >> 32));
+}
+
+// Triangular walk over the groups; with a power of two number of groups it
+// visits each of them exactly once.
+class ProbeSeq {
+ public:
+  ProbeSeq(size_t hash, size_t mask) : mask_(mask), group_(hash & mask) {}
+  size_t offset() const { return group_ * kGroupWidth; }
+  void next() {
+    ++step_;
+    group_ = (group_ + step_) & mask_;
+  }
+
+ private:
+  size_t mask_;
+  size_t group_;
+  size_t step_ = 0;
+};
+
+template <typename Value>
+class HashIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value*;
+  using reference = Value&;
+
+  HashIterator() = default;
+  HashIterator(const int8_t* ctrl, Value* slot, const int8_t* end)
+      : ctrl_(ctrl), slot_(slot), end_(end) {
+    skip_free();
+  }
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same_v<const Other, Value> &&
+                                !std::is_same_v<Other, Value>>>
+  HashIterator(const HashIterator<Other>& other)
+      : ctrl_(other.ctrl_), slot_(other.slot_), end_(other.end_) {}
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+  HashIterator& operator++() {
+    ++ctrl_;
+    ++slot_;
+    skip_free();
+    return *this;
+  }
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  bool operator==(const HashIterator& other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const HashIterator& other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+ private:
+  template <typename>
+  friend class HashIterator;
+  template <typename, typename, typename, typename>
+  friend class s21::UnorderedMap;
+
+  const int8_t* ctrl_ = nullptr;
+  Value* slot_ = nullptr;
+  const int8_t* end_ = nullptr;
+
+  void skip_free() {
+    while (ctrl_ != end_ && *ctrl_ < 0) {
+      ++ctrl_;
+      ++slot_;
+    }
+  }
+};
+}  // namespace hash_internal
+
+// Open addressing hash map in the Swiss table layout: a flat array of slots
+// with one control byte per slot. Lookups compare 7 bits of the hash against
+// a whole group of 16 control bytes at a time, so only real candidates touch
+// the slots. The table is kept at most 7/8 full.
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+class UnorderedMap {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = hash_internal::HashIterator<value_type>;
+  using const_iterator = hash_internal::HashIterator<const value_type>;
+
+  UnorderedMap();
+  UnorderedMap(std::initializer_list<value_type> const &items);
+  UnorderedMap(const UnorderedMap &m);
+  UnorderedMap(UnorderedMap &&m) noexcept;
+  ~UnorderedMap();
+  UnorderedMap &operator=(const UnorderedMap &m);
+  UnorderedMap &operator=(UnorderedMap &&m) noexcept;
+
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;  // number of slots in the table
+  void reserve(size_type count);  // makes room for count elements
+  mapped_type const *find(key_type const &key) const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(key_type const &key, mapped_type const &obj);
+  std::pair<iterator, bool> insert_or_assign(key_type const &key,
+                                             mapped_type const &obj);
+  mapped_type &at(const key_type &key);
+  mapped_type &operator[](const key_type &key);
+  void swap(UnorderedMap &other);
+  bool contains(const key_type &key) const;
+  void merge(UnorderedMap &other);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  template <typename... Args>
+  s21::Vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+ private:
+  static constexpr stats::Kind kStats = stats::Kind::kUnorderedMap;
+
+  int8_t *ctrl_ = nullptr;
+  value_type *slots_ = nullptr;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  size_t growth_left_ = 0;  // empty slots that may still be filled
+  hasher hash_;
+  key_equal equal_;
+
+  size_t hash_of(const key_type &key) const;
+  size_t find_index(const key_type &key, size_t hash) const;
+  size_t find_free(size_t hash) const;
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(const key_type &key,
+                                           Args &&...args);
+  void erase_at(size_t index);
+  void resize(size_t new_capacity);
+  void destroy();
+  iterator iterator_at(size_t index);
+  static size_t max_load(size_t capacity);
+  static size_t capacity_for(size_type count);
+  static int8_t h2(size_t hash);
+};
+/*---------------------definitions-------------*/
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap() = default;
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(
+    std::initializer_list<value_type> const &items)
+    : UnorderedMap() {
+  reserve(items.size());
+  for (auto const &item : items) {
+    insert(item);
+  }
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(const UnorderedMap &m)
+    : hash_(m.hash_), equal_(m.equal_) {
+  reserve(m.size_);
+  for (auto const &item : m) {
+    insert(item);
+  }
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(UnorderedMap &&m) noexcept {
+  swap(m);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::~UnorderedMap() {
+  destroy();
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual> &
+UnorderedMap<Key, T, Hash, KeyEqual>::operator=(const UnorderedMap &m) {
+  if (this != &m) {
+    UnorderedMap tmp(m);
+    swap(tmp);
+  }
+  return *this;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual> &
+UnorderedMap<Key, T, Hash, KeyEqual>::operator=(UnorderedMap &&m) noexcept {
+  if (this != &m) {
+    destroy();
+    swap(m);
+  }
+  return *this;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::begin() {
+  return iterator(ctrl_, slots_, ctrl_ + capacity_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::const_iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::begin() const {
+  return const_iterator(ctrl_, slots_, ctrl_ + capacity_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::end() {
+  return iterator_at(capacity_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::const_iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::end() const {
+  return const_iterator(ctrl_ + capacity_, slots_ + capacity_,
+                        ctrl_ + capacity_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool UnorderedMap<Key, T, Hash, KeyEqual>::empty() const {
+  return size_ == 0;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::size() const {
+  return size_;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::max_size() const {
+  return SIZE_MAX / (sizeof(value_type) + 1);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::capacity() const {
+  return capacity_;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  if (count > max_size()) throw std::bad_alloc();
+  size_t new_capacity = capacity_for(count);
+  if (new_capacity > capacity_) resize(new_capacity);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+const T *UnorderedMap<Key, T, Hash, KeyEqual>::find(key_type const &key) const {
+  size_t index = find_index(key, hash_of(key));
+  return index == capacity_ ? nullptr : &slots_[index].second;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::clear() {
+  for (size_t i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) slots_[i].~value_type();
+  }
+  if (capacity_) std::memset(ctrl_, hash_internal::kEmpty, capacity_);
+  size_ = 0;
+  growth_left_ = max_load(capacity_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert(const value_type &value) {
+  return emplace_unique(value.first, value);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert(key_type const &key,
+                                             mapped_type const &obj) {
+  return emplace_unique(key, key, obj);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert_or_assign(key_type const &key,
+                                                       mapped_type const &obj) {
+  auto result = emplace_unique(key, key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &UnorderedMap<Key, T, Hash, KeyEqual>::at(const key_type &key) {
+  size_t index = find_index(key, hash_of(key));
+  if (index == capacity_) throw std::out_of_range("Key not found");
+  return slots_[index].second;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &UnorderedMap<Key, T, Hash, KeyEqual>::operator[](const key_type &key) {
+  return emplace_unique(key, std::piecewise_construct,
+                        std::forward_as_tuple(key), std::forward_as_tuple())
+      .first->second;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::swap(UnorderedMap &other) {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool UnorderedMap<Key, T, Hash, KeyEqual>::contains(const key_type &key) const {
+  return find_index(key, hash_of(key)) != capacity_;
+}
+// moves over the elements whose keys are missing here, the rest stay in other
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::merge(UnorderedMap &other) {
+  if (this == &other) return;
+  for (size_t i = 0; i < other.capacity_; ++i) {
+    if (other.ctrl_[i] < 0) continue;
+    value_type &item = other.slots_[i];
+    if (emplace_unique(item.first, std::move(item)).second) other.erase_at(i);
+  }
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  erase_at(pos.ctrl_ - ctrl_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::erase(const key_type &key) {
+  size_t index = find_index(key, hash_of(key));
+  if (index == capacity_) return 0;
+  erase_at(index);
+  return 1;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+s21::Vector<
+    std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert_many(Args &&...args) {
+  reserve(size_ + sizeof...(Args));
+  s21::Vector<std::pair<iterator, bool>> result = {(insert(args))...};
+  return result;
+}
+/*---------------------private-----------------*/
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::hash_of(
+    const key_type &key) const {
+  return hash_internal::mix_hash(hash_(key));
+}
+// index of the slot holding key, or capacity_ when there is none
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::find_index(const key_type &key,
+                                                        size_t hash) const {
+  if (capacity_ == 0) return capacity_;
+  hash_internal::ProbeSeq seq(hash >> 7,
+                              capacity_ / hash_internal::kGroupWidth - 1);
+  while (true) {
+    hash_internal::Group group(ctrl_ + seq.offset());
+    for (uint32_t mask = group.match(h2(hash)); mask; mask &= mask - 1) {
+      size_t index = seq.offset() + hash_internal::lowest_bit(mask);
+      if (equal_(slots_[index].first, key)) return index;
+    }
+    // an empty slot ends every probe sequence that reaches this group
+    if (group.match_empty()) return capacity_;
+    seq.next();
+  }
+}
+// first empty or deleted slot on the probe sequence of hash
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::find_free(size_t hash) const {
+  hash_internal::ProbeSeq seq(hash >> 7,
+                              capacity_ / hash_internal::kGroupWidth - 1);
+  while (true) {
+    hash_internal::Group group(ctrl_ + seq.offset());
+    uint32_t mask = group.match_empty_or_deleted();
+    if (mask) return seq.offset() + hash_internal::lowest_bit(mask);
+    seq.next();
+  }
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::emplace_unique(const key_type &key,
+                                                     Args &&...args) {
+  size_t hash = hash_of(key);
+  size_t index = find_index(key, hash);
+  if (index != capacity_) return {iterator_at(index), false};
+  if (capacity_ == 0) resize(hash_internal::kGroupWidth);
+  index = find_free(hash);
+  if (growth_left_ == 0 && ctrl_[index] == hash_internal::kEmpty) {
+    // grow when live elements fill half the allowed load, otherwise the
+    // table is mostly tombstones and a rehash in place clears them
+    bool grow = size_ * 2 >= max_load(capacity_);
+    // args may refer to an element of this map, which the rehash moves
+    value_type value(std::forward<Args>(args)...);
+    resize(grow ? capacity_ * 2 : capacity_);
+    index = find_free(hash);
+    new (slots_ + index) value_type(std::move(value));
+    stats::on_move(kStats);
+  } else {
+    new (slots_ + index) value_type(std::forward<Args>(args)...);
+  }
+  stats::on_construct<value_type, Args...>(kStats);
+  if (ctrl_[index] == hash_internal::kEmpty) --growth_left_;
+  ctrl_[index] = h2(hash);
+  ++size_;
+  return {iterator_at(index), true};
+}
+// A slot can go straight back to empty when its group still has an empty
+// slot, since no probe sequence ever went past that group. Otherwise it
+// becomes a tombstone.
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::erase_at(size_t index) {
+  slots_[index].~value_type();
+  --size_;
+  size_t group = index & ~(hash_internal::kGroupWidth - 1);
+  if (hash_internal::Group(ctrl_ + group).match_empty()) {
+    ctrl_[index] = hash_internal::kEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[index] = hash_internal::kDeleted;
+  }
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::resize(size_t new_capacity) {
+  std::allocator<value_type> alloc;
+  value_type *new_slots = alloc.allocate(new_capacity);
+  int8_t *new_ctrl = nullptr;
+  try {
+    new_ctrl = new int8_t[new_capacity];
+  } catch (...) {
+    alloc.deallocate(new_slots, new_capacity);
+    throw;
+  }
+  std::memset(new_ctrl, hash_internal::kEmpty, new_capacity);
+  stats::on_allocate(kStats, new_capacity * sizeof(value_type));
+  stats::on_allocate(kStats, new_capacity);
+  int8_t *old_ctrl = ctrl_;
+  value_type *old_slots = slots_;
+  size_t old_capacity = capacity_;
+  ctrl_ = new_ctrl;
+  slots_ = new_slots;
+  capacity_ = new_capacity;
+  growth_left_ = max_load(new_capacity) - size_;
+  for (size_t i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] < 0) continue;
+    size_t hash = hash_of(old_slots[i].first);
+    size_t index = find_free(hash);
+    new (slots_ + index) value_type(std::move(old_slots[i]));
+    ctrl_[index] = h2(hash);
+    old_slots[i].~value_type();
+  }
+  delete[] old_ctrl;
+  if (!old_slots) return;
+  alloc.deallocate(old_slots, old_capacity);
+  stats::on_free(kStats, old_capacity * sizeof(value_type));
+  stats::on_free(kStats, old_capacity);
+  stats::on_reallocate(kStats);
+  stats::on_move(kStats, size_);
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::destroy() {
+  if (!capacity_) return;
+  clear();
+  delete[] ctrl_;
+  std::allocator<value_type>().deallocate(slots_, capacity_);
+  stats::on_free(kStats, capacity_ * sizeof(value_type));
+  stats::on_free(kStats, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = growth_left_ = 0;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::iterator_at(size_t index) {
+  iterator it;
+  it.ctrl_ = ctrl_ + index;
+  it.slot_ = slots_ + index;
+  it.end_ = ctrl_ + capacity_;
+  return it;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::max_load(size_t capacity) {
+  return capacity - capacity / 8;
+}
+// smallest power of two number of groups that holds count elements
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t UnorderedMap<Key, T, Hash, KeyEqual>::capacity_for(size_type count) {
+  if (count == 0) return 0;
+  size_t capacity = hash_internal::kGroupWidth;
+  while (max_load(capacity) < count) capacity *= 2;
+  return capacity;
+}
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+int8_t UnorderedMap<Key, T, Hash, KeyEqual>::h2(size_t hash) {
+  return static_cast<int8_t>(hash & 0x7F);
+}
+}  // namespace s21
+#endif  // SRC_S21_UNORDERED_MAP_H_
@@ -1,9 +1,17 @@
 #ifndef SRC_S21_VECTOR_H_
 #define SRC_S21_VECTOR_H_
 #include "s21_helpsrc.h"
+#include "s21_relocate.h"
+#include "s21_stats.h"
 namespace s21 {
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class Vector {
+  using alloc_traits = std::allocator_traits<Alloc>;
+  static constexpr stats::Kind kStats = stats::Kind::kVector;
+  static constexpr bool kNothrowMoveAssign =
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value;
+
  public:
   using value_type = T;
   using reference = T&;
@@ -11,18 +19,26 @@ class Vector {
   using iterator = T*;
   using const_iterator = const T*;
   using size_type = size_t;
+  using allocator_type = Alloc;
 
   Vector();  // default constructor, creates empty vector
-  Vector(
-      size_type n);  // parameterized constructor, creates the vector of size n
-  Vector(std::initializer_list<value_type> const&
-             items);            // initializer list constructor, creates vector
-                                // initizialized using std::initializer_list
+  explicit Vector(const allocator_type& alloc);  // empty, storage from alloc
+  Vector(size_type n,
+         const allocator_type& alloc =
+             allocator_type());  // parameterized constructor, creates the
+                                 // vector of size n
+  Vector(std::initializer_list<value_type> const& items,
+         const allocator_type& alloc =
+             allocator_type());  // initializer list constructor, creates
+                                 // vector initizialized using
+                                 // std::initializer_list
   Vector(const Vector& v);      // copy constructor
   Vector(Vector&& v) noexcept;  // move constructor
-  Vector& operator=(
-      Vector&& v) noexcept;  // assignment operator overload for moving object
-  ~Vector();                 // destructor
+  // steals the storage when the allocator propagates or compares equal and
+  // moves element by element otherwise
+  Vector& operator=(Vector&& v) noexcept(kNothrowMoveAssign);
+  ~Vector();  // destructor
+  allocator_type get_allocator() const;
 
   reference at(size_type pos);  // access specified element with bounds checking
   reference operator[](size_type pos);  // access specified element
@@ -51,9 +67,27 @@ class Vector {
                                // the iterator that points to the new element
   void erase(iterator pos);    // erases element at pos
   void push_back(const_reference value);  // adds an element to the end
+  void push_back(value_type&& value);     // moves an element to the end
+  template <typename... Args>
+  reference emplace_back(
+      Args&&... args);  // constructs an element in place at the end
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args&&... args);  // constructs an element in place
+                                     // before pos
   void pop_back();                        // removes the last element
   void swap(Vector& other);               // swaps the contents
 
+  template <typename InputIt,
+            typename = std::enable_if_t<std::is_convertible_v<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>>>
+  iterator insert(const_iterator pos, InputIt first,
+                  InputIt last);  // inserts [first, last) before pos and
+                                  // returns the iterator to the first of them
+  template <typename Range>
+  void append_range(Range&& range);  // appends the elements of range
+
   template <typename... Args>
   iterator insert_many(const_iterator pos,
                        Args&&... args);  // inserts new elements into the
@@ -66,88 +100,107 @@ class Vector {
   T* arr_;
   size_t capacity_;
   size_t size_;
+  allocator_type alloc_;
+
+  value_type* allocate(size_type n);
+  void deallocate(value_type* p, size_type n) noexcept;
+  void reallocate(size_type new_capacity);
+  template <typename ForwardIt>
+  iterator insert_forward(size_type index, ForwardIt first, size_type count);
 };
 //--------------------------------------------------------------------
 // Implementation
 //--------------------------------------------------------------------
-template <typename value_type>
-Vector<value_type>::Vector() {
-  arr_ = nullptr;
-  size_ = 0;
-  capacity_ = 0;
-}
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector() : Vector(allocator_type()) {}
+
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector(const allocator_type& alloc)
+    : arr_(nullptr), capacity_(0), size_(0), alloc_(alloc) {}
 
-template <typename value_type>
-Vector<value_type>::Vector(size_type value) {
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector(size_type value, const allocator_type& alloc)
+    : Vector(alloc) {
   if (value > max_size()) throw std::bad_alloc();
-  size_ = value;
+  arr_ = allocate(value);
   capacity_ = value;
-  arr_ = reinterpret_cast<value_type*>(new int8_t[value * sizeof(value_type)]);
-  ;
-  for (size_t i = 0; i < value; i++) {
-    arr_[i] = value_type();
+  for (; size_ < value; ++size_) {
+    new (arr_ + size_) value_type();
   }
 }
 
-template <typename value_type>
-Vector<value_type>::Vector(std::initializer_list<value_type> const& items) {
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector(
+    std::initializer_list<value_type> const& items, const allocator_type& alloc)
+    : Vector(alloc) {
   if (items.size() > max_size()) throw std::bad_alloc();
-  size_ = items.size();
+  arr_ = allocate(items.size());
   capacity_ = items.size();
-  arr_ =
-      reinterpret_cast<value_type*>(new int8_t[capacity_ * sizeof(value_type)]);
   std::uninitialized_copy(items.begin(), items.end(), arr_);
+  size_ = items.size();
+  stats::on_copy(kStats, size_);
 }
 
-template <typename value_type>
-Vector<value_type>::Vector(const Vector& v) {
-  this->size_ = v.size_;
-  this->capacity_ = v.capacity_;
-  arr_ =
-      reinterpret_cast<value_type*>(new int8_t[capacity_ * sizeof(value_type)]);
-  try {
-    std::uninitialized_copy(v.arr_, v.arr_ + v.size_, arr_);
-  } catch (...) {
-    delete[] reinterpret_cast<int8_t*>(arr_);
-    throw std::bad_alloc();
-  }
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector(const Vector& v)
+    : Vector(alloc_traits::select_on_container_copy_construction(v.alloc_)) {
+  arr_ = allocate(v.capacity_);
+  capacity_ = v.capacity_;
+  std::uninitialized_copy(v.arr_, v.arr_ + v.size_, arr_);
+  size_ = v.size_;
+  stats::on_copy(kStats, size_);
 }
 
-template <typename value_type>
-Vector<value_type>::Vector(Vector&& v) noexcept {
-  this->size_ = v.size_;
-  this->capacity_ = v.capacity_;
-  this->arr_ = v.arr_;
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::Vector(Vector&& v) noexcept
+    : arr_(v.arr_), capacity_(v.capacity_), size_(v.size_), alloc_(v.alloc_) {
   v.size_ = 0;
   v.capacity_ = 0;
   v.arr_ = nullptr;
 }
 
-template <typename value_type>
-Vector<value_type>::~Vector() {
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>::~Vector() {
   clear();
-  size_ = 0;
+  deallocate(arr_, capacity_);
   capacity_ = 0;
-  delete[] reinterpret_cast<int8_t*>(arr_);
   arr_ = nullptr;
 }
 
-template <typename value_type>
-Vector<value_type>& Vector<value_type>::operator=(Vector&& v) noexcept {
-  if (this != &v) {
-    this->clear();
-    this->arr_ = v.arr_;
-    this->size_ = v.size_;
-    this->capacity_ = v.capacity_;
-    v.arr_ = nullptr;
-    v.size_ = 0;
-    v.capacity_ = 0;
+template <typename value_type, typename Alloc>
+Vector<value_type, Alloc>& Vector<value_type, Alloc>::operator=(
+    Vector&& v) noexcept(kNothrowMoveAssign) {
+  if (this == &v) return *this;
+  constexpr bool propagate =
+      alloc_traits::propagate_on_container_move_assignment::value;
+  if (!propagate && !(alloc_ == v.alloc_)) {
+    // the storage of v belongs to another resource, so only the elements move
+    clear();
+    reserve(v.size_);
+    internal::transfer(kStats, v.arr_, v.size_, arr_);
+    size_ = v.size_;
+    v.clear();
+    return *this;
   }
+  clear();
+  deallocate(arr_, capacity_);
+  if constexpr (propagate) alloc_ = v.alloc_;
+  arr_ = v.arr_;
+  size_ = v.size_;
+  capacity_ = v.capacity_;
+  v.arr_ = nullptr;
+  v.size_ = 0;
+  v.capacity_ = 0;
   return *this;
 }
 
-template <typename value_type>
-value_type& Vector<value_type>::at(size_type pos) {
+template <typename value_type, typename Alloc>
+Alloc Vector<value_type, Alloc>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename value_type, typename Alloc>
+value_type& Vector<value_type, Alloc>::at(size_type pos) {
   if (pos < size_) {
     return arr_[pos];
   } else {
@@ -155,99 +208,68 @@ value_type& Vector<value_type>::at(size_type pos) {
   }
 }
 
-template <typename value_type>
-value_type& Vector<value_type>::operator[](size_type pos) {
+template <typename value_type, typename Alloc>
+value_type& Vector<value_type, Alloc>::operator[](size_type pos) {
   return arr_[pos];
 }
 
-template <typename value_type>
-const value_type& Vector<value_type>::front() {
+template <typename value_type, typename Alloc>
+const value_type& Vector<value_type, Alloc>::front() {
   if (this->empty()) throw std::out_of_range("Index out of range");
   return arr_[0];
 }
 
-template <typename value_type>
-const value_type& Vector<value_type>::back() {
+template <typename value_type, typename Alloc>
+const value_type& Vector<value_type, Alloc>::back() {
   if (this->empty()) throw std::out_of_range("Index out of range");
   return arr_[size_ - 1];
 }
 
-template <typename value_type>
-value_type* Vector<value_type>::data() {
+template <typename value_type, typename Alloc>
+value_type* Vector<value_type, Alloc>::data() {
   return arr_;
 }
 
-template <typename value_type>
-inline value_type* Vector<value_type>::begin() {
+template <typename value_type, typename Alloc>
+inline value_type* Vector<value_type, Alloc>::begin() {
   return iterator(arr_);
 }
 
-template <typename value_type>
-inline value_type* Vector<value_type>::end() {
+template <typename value_type, typename Alloc>
+inline value_type* Vector<value_type, Alloc>::end() {
   return iterator(arr_ + size_);
 }
 
-template <typename value_type>
-size_t Vector<value_type>::size() {
+template <typename value_type, typename Alloc>
+size_t Vector<value_type, Alloc>::size() {
   return this->size_;
 }
 
-template <typename value_type>
-size_t Vector<value_type>::max_size() {
+template <typename value_type, typename Alloc>
+size_t Vector<value_type, Alloc>::max_size() {
   return SIZE_MAX / sizeof(value_type);
 }
 
-template <typename value_type>
-size_t Vector<value_type>::capacity() {
+template <typename value_type, typename Alloc>
+size_t Vector<value_type, Alloc>::capacity() {
   return this->capacity_;
 }
 
-template <typename value_type>
-void Vector<value_type>::shrink_to_fit() {
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::shrink_to_fit() {
   if (capacity_ == size_) return;
-  value_type* new_arr =
-      reinterpret_cast<value_type*>(new int8_t[size_ * sizeof(value_type)]);
-  try {
-    std::uninitialized_copy(arr_, arr_ + size_, new_arr);
-  } catch (...) {
-    delete[] reinterpret_cast<int8_t*>(new_arr);
-    throw;
-  }
-  for (size_t i = 0; i < size_; ++i) {
-    (arr_ + i)->~value_type();
-  }
-  delete[] reinterpret_cast<int8_t*>(arr_);
-  arr_ = new_arr;
-  capacity_ = size_;
+  reallocate(size_);
 }
 
-template <typename value_type>
-void Vector<value_type>::reserve(size_type new_capacity) {
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::reserve(size_type new_capacity) {
   if (new_capacity <= capacity_) return;
   if (new_capacity > max_size()) throw std::bad_alloc();
-  value_type* new_arr = reinterpret_cast<value_type*>(
-      new int8_t[new_capacity * sizeof(value_type)]);
-  try {
-    std::uninitialized_copy(arr_, arr_ + size_, new_arr);
-  } catch (...) {
-    delete[] reinterpret_cast<int8_t*>(new_arr);
-    throw std::bad_alloc();
-  }
-
-  if (arr_ != nullptr) {
-    for (size_t i = 0; i < size_; ++i) {
-      if ((arr_ + i) != nullptr) {
-        (arr_ + i)->~value_type();
-      }
-    }
-    delete[] reinterpret_cast<int8_t*>(arr_);
-  }
-  arr_ = new_arr;
-  capacity_ = new_capacity;
+  reallocate(new_capacity);
 }
 
-template <typename value_type>
-void Vector<value_type>::resize(size_type new_size) {
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::resize(size_type new_size) {
   if (new_size > capacity_) reserve(new_size);
   for (size_t i = size_; i < new_size; ++i) {
     new (arr_ + i) value_type();
@@ -255,106 +277,225 @@ void Vector<value_type>::resize(size_type new_size) {
   size_ = new_size;
 }
 
-template <typename value_type>
-bool Vector<value_type>::empty() {
+template <typename value_type, typename Alloc>
+bool Vector<value_type, Alloc>::empty() {
   return (size_ == 0 ? true : false);
 }
 
-template <typename value_type>
-void Vector<value_type>::clear() {
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::clear() {
   for (size_t i = 0; i < size_; ++i) {
     (arr_ + i)->~value_type();
   }
   size_ = 0;
 }
 
-template <typename value_type>
-typename Vector<value_type>::iterator Vector<value_type>::insert(
+template <typename value_type, typename Alloc>
+typename Vector<value_type, Alloc>::iterator Vector<value_type, Alloc>::insert(
     iterator pos, const_reference value) {
   if (size_ == 0) {
     push_back(value);
     return begin();
   }
+  return emplace(pos, value);
+}
+
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::erase(iterator pos) {
+  stats::on_move(kStats, end() - pos - 1);
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename value_type, typename Alloc>
+template <typename... Args>
+value_type& Vector<value_type, Alloc>::emplace_back(Args&&... args) {
+  if (capacity_ == size_) {
+    // args may refer to an element of this vector, so build the new value
+    // before the old storage goes away
+    value_type value(std::forward<Args>(args)...);
+    reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    new (arr_ + size_) value_type(std::move(value));
+    stats::on_move(kStats);
+  } else {
+    new (arr_ + size_) value_type(std::forward<Args>(args)...);
+  }
+  stats::on_construct<value_type, Args...>(kStats);
+  return arr_[size_++];
+}
 
+template <typename value_type, typename Alloc>
+template <typename... Args>
+typename Vector<value_type, Alloc>::iterator Vector<value_type, Alloc>::emplace(
+    const_iterator pos, Args&&... args) {
   if (pos < this->begin() || pos > this->end()) {
     throw std::out_of_range("position is out of range");
   }
-
   size_t index = pos - this->begin();
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return this->begin() + index;
+  }
+  value_type value(std::forward<Args>(args)...);
   if (size_ == capacity_) {
-    reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    reserve(capacity_ * 2);
   }
-
-  resize(size_ + 1);
-  std::move_backward(this->begin() + index, this->end() - 1, this->end());
-  iterator result = this->begin() + index;
-  arr_[index] = value;
-  return result;
+  new (arr_ + size_) value_type(std::move(arr_[size_ - 1]));
+  ++size_;
+  std::move_backward(this->begin() + index, this->end() - 2, this->end() - 1);
+  arr_[index] = std::move(value);
+  stats::on_construct<value_type, Args...>(kStats);
+  stats::on_move(kStats, size_ - index);
+  return this->begin() + index;
 }
 
-template <typename value_type>
-void Vector<value_type>::erase(iterator pos) {
-  for (iterator i = pos; i != end() - 1; ++i) {
-    *(i) = *(i + 1);
-  }
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::pop_back() {
   --size_;
+  (arr_ + size_)->~value_type();
 }
 
-template <typename value_type>
-void Vector<value_type>::push_back(const_reference value) {
-  if (capacity_ == size_) {
-    reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-  }
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::swap(Vector<value_type, Alloc>& other) {
+  std::swap(arr_, other.arr_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  swap_allocators(alloc_, other.alloc_);
+}
+
+//--------------------------------------------------------------------
+// Implementation private
+//--------------------------------------------------------------------
+
+template <typename value_type, typename Alloc>
+value_type* Vector<value_type, Alloc>::allocate(size_type n) {
+  if (!n) return nullptr;
+  value_type* p = alloc_traits::allocate(alloc_, n);
+  stats::on_allocate(kStats, n * sizeof(value_type));
+  return p;
+}
+
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::deallocate(value_type* p,
+                                           size_type n) noexcept {
+  if (!p) return;
+  alloc_traits::deallocate(alloc_, p, n);
+  stats::on_free(kStats, n * sizeof(value_type));
+}
+
+// moves the elements into fresh storage of new_capacity elements
+template <typename value_type, typename Alloc>
+void Vector<value_type, Alloc>::reallocate(size_type new_capacity) {
+  value_type* new_arr = allocate(new_capacity);
   try {
-    new (arr_ + size_) value_type(value);
+    internal::transfer(kStats, arr_, size_, new_arr);
   } catch (...) {
-    (arr_ + size_)->~value_type();
+    deallocate(new_arr, new_capacity);
     throw;
   }
-  size_++;
+  std::destroy_n(arr_, size_);
+  deallocate(arr_, capacity_);
+  if (arr_) stats::on_reallocate(kStats);
+  arr_ = new_arr;
+  capacity_ = new_capacity;
 }
 
-template <typename value_type>
-void Vector<value_type>::pop_back() {
-  --size_;
-  (arr_ + size_)->~value_type();
+// Opens a gap of count elements before index and copies [first, first + count)
+// into it. When the storage is too small the new elements are built in the
+// new buffer before anything is taken from the old one.
+template <typename value_type, typename Alloc>
+template <typename ForwardIt>
+typename Vector<value_type, Alloc>::iterator
+Vector<value_type, Alloc>::insert_forward(
+    size_type index, ForwardIt first, size_type count) {
+  if (count == 0) return begin() + index;
+  if (count > max_size() - size_) throw std::bad_alloc();
+  stats::on_construct<value_type, decltype(*first)>(kStats, count);
+  if (size_ + count > capacity_) {
+    size_type new_capacity = std::max(size_ + count, capacity_ * 2);
+    value_type* new_arr = allocate(new_capacity);
+    try {
+      internal::insert_relocating(kStats, arr_, size_, index, first, count,
+                                  new_arr);
+    } catch (...) {
+      deallocate(new_arr, new_capacity);
+      throw;
+    }
+    std::destroy_n(arr_, size_);
+    deallocate(arr_, capacity_);
+    if (arr_) stats::on_reallocate(kStats);
+    arr_ = new_arr;
+    capacity_ = new_capacity;
+    size_ += count;
+    return arr_ + index;
+  }
+  internal::insert_shifting(kStats, arr_, size_, index, first, count);
+  return arr_ + index;
 }
 
-template <typename value_type>
-void Vector<value_type>::swap(Vector<value_type>& other) {
-  s21::Vector<value_type> tmp;
-  tmp.arr_ = this->arr_;
-  tmp.size_ = this->size_;
-  tmp.capacity_ = this->capacity_;
-  this->arr_ = other.arr_;
-  this->size_ = other.size_;
-  this->capacity_ = other.capacity_;
-  other.arr_ = tmp.arr_;
-  other.size_ = tmp.size_;
-  other.capacity_ = tmp.capacity_;
-  tmp.arr_ = nullptr;
-  tmp.size_ = 0;
-  tmp.capacity_ = 0;
-}
-
-template <typename value_type>
+template <typename value_type, typename Alloc>
+template <typename InputIt, typename>
+typename Vector<value_type, Alloc>::iterator Vector<value_type, Alloc>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  if (pos < this->begin() || pos > this->end()) {
+    throw std::out_of_range("position is out of range");
+  }
+  size_t index = pos - this->begin();
+  if constexpr (std::is_convertible_v<
+                    typename std::iterator_traits<InputIt>::iterator_category,
+                    std::forward_iterator_tag>) {
+    return insert_forward(index, first, std::distance(first, last));
+  } else {
+    // single pass input, so buffer it to learn the count
+    Vector buffer(alloc_);
+    for (; first != last; ++first) buffer.emplace_back(*first);
+    return insert_forward(index, std::make_move_iterator(buffer.begin()),
+                          buffer.size());
+  }
+}
+
+template <typename value_type, typename Alloc>
+template <typename Range>
+void Vector<value_type, Alloc>::append_range(Range&& range) {
+  insert(this->end(), std::begin(range), std::end(range));
+}
+
+// The values are built up front, so arguments referring to elements of this
+// vector stay valid, and then go in with a single shift of the tail.
+template <typename value_type, typename Alloc>
 template <typename... Args>
-typename Vector<value_type>::iterator Vector<value_type>::insert_many(
+typename Vector<value_type, Alloc>::iterator
+Vector<value_type, Alloc>::insert_many(
     const_iterator pos, Args&&... args) {
-  iterator it = const_cast<iterator>(pos);
-  for (auto value : {std::forward<Args>(args)...}) {
-    it = insert(it, value);
-    it++;
+  if constexpr (sizeof...(Args) == 0) {
+    return const_cast<iterator>(pos);
+  } else {
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+    iterator it = insert(pos, std::make_move_iterator(std::begin(values)),
+                         std::make_move_iterator(std::end(values)));
+    return it + (sizeof...(Args) - 1);
   }
-  return --it;
 }
 
-template <typename value_type>
+template <typename value_type, typename Alloc>
 template <typename... Args>
-void Vector<value_type>::insert_many_back(Args&&... args) {
-  for (auto value : {std::forward<Args>(args)...}) {
-    push_back(value);
-  }
+void Vector<value_type, Alloc>::insert_many_back(Args&&... args) {
+  insert_many(this->end(), std::forward<Args>(args)...);
 }
+
+namespace pmr {
+template <typename T>
+using Vector = s21::Vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 #endif  // SRC_S21_VECTOR_H_
\ No newline at end of file
@@ -0,0 +1,152 @@
+#ifndef SRC_S21_WORK_STEALING_DEQUE_H_
+#define SRC_S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+
+#include "s21_helpsrc.h"
+
+namespace s21 {
+// Chase-Lev work-stealing deque, with the memory orders of Le, Pop, Cohen
+// and Zappa Nardelli's C11 version. One thread owns the deque and pushes
+// and pops at the bottom, last in first out; any other thread may steal
+// from the top, first in first out. Only a steal racing the owner for the
+// last element needs a CAS, so the owner's push and pop are a few plain
+// loads and stores.
+//
+// The ring doubles when the owner finds it full. Thieves may still be
+// reading the old ring, so retired rings are kept until the deque goes.
+// Elements are copied in and out of atomic slots and must be trivially
+// copyable; task pointers are the usual choice.
+template <class T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "slots are read by thieves while the owner may overwrite them");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // capacity is rounded up to a power of two
+  explicit WorkStealingDeque(size_type capacity = 1024)
+      : ring_(new Ring(round_up(capacity), nullptr)) {}
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+  // must not race with other calls
+  ~WorkStealingDeque() {
+    for (Ring* ring = ring_.load(std::memory_order_relaxed); ring;) {
+      Ring* previous = ring->previous;
+      delete ring;
+      ring = previous;
+    }
+  }
+
+  // Owner only
+  void push(const_reference value) {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    Ring* ring = ring_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<std::ptrdiff_t>(ring->mask)) {
+      ring = grow(ring, top, bottom);
+    }
+    ring->put(bottom, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  bool try_pop(reference out) {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Ring* ring = ring_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {  // empty
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    out = ring->get(bottom);
+    if (top == bottom) {
+      // the last element: whoever moves top first has it
+      bool won = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  // Any thread; false when the deque is empty or another thread took the
+  // element first
+  bool try_steal(reference out) {
+    std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) return false;
+    Ring* ring = ring_.load(std::memory_order_acquire);
+    T value = ring->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    out = value;
+    return true;
+  }
+
+  // only a snapshot while other threads are stealing
+  size_type size_approx() const {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  bool empty_approx() const { return size_approx() == 0; }
+  size_type capacity() const {
+    return ring_.load(std::memory_order_relaxed)->mask + 1;
+  }
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+
+  struct Ring {
+    Ring(size_t capacity, Ring* previous)
+        : mask(capacity - 1),
+          slots(new std::atomic<T>[capacity]),
+          previous(previous) {}
+    Ring(const Ring&) = delete;
+    Ring& operator=(const Ring&) = delete;
+    ~Ring() { delete[] slots; }
+
+    T get(std::ptrdiff_t index) const {
+      return slots[index & mask].load(std::memory_order_relaxed);
+    }
+    void put(std::ptrdiff_t index, const T& value) {
+      slots[index & mask].store(value, std::memory_order_relaxed);
+    }
+
+    const size_t mask;
+    std::atomic<T>* const slots;
+    Ring* const previous;  // retired, freed with the deque
+  };
+
+  // thieves hammer top_, the owner bottom_
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> bottom_{0};
+  std::atomic<Ring*> ring_;
+
+  static size_t round_up(size_t capacity) {
+    size_t result = 1;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  Ring* grow(Ring* ring, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+    Ring* bigger = new Ring(2 * (ring->mask + 1), ring);
+    for (std::ptrdiff_t i = top; i < bottom; ++i) bigger->put(i, ring->get(i));
+    ring_.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_WORK_STEALING_DEQUE_H_
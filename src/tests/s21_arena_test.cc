@@ -0,0 +1,177 @@
+#include "../s21_arena.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_multiset.h"
+#include "../s21_set.h"
+
+namespace s21 {
+template <typename T>
+using ArenaSet = Set<T, std::less<T>, ArenaAllocator<T>>;
+template <typename T>
+using ArenaMultiset = Multiset<T, std::less<T>, ArenaAllocator<T>>;
+template <typename K, typename T>
+using ArenaMap = Map<K, T, std::less<K>, ArenaAllocator<std::pair<const K, T>>>;
+template <typename T>
+using ArenaList = List<T, ArenaAllocator<T>>;
+
+// base is the first byte taken from an arena that still has a single chunk
+static bool inside(const Arena &arena, const void *ptr, const char *base) {
+  const char *p = static_cast<const char *>(ptr);
+  return p > base && p < base + arena.bytes_reserved();
+}
+
+TEST(ArenaTest, BumpsAndAligns) {
+  Arena arena(4096);
+  EXPECT_EQ(arena.chunk_count(), 0u);
+  char *a = static_cast<char *>(arena.allocate(1, 1));
+  char *b = static_cast<char *>(arena.allocate(8, 8));
+  char *c = static_cast<char *>(arena.allocate(1, 1));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, 0u);
+  EXPECT_GT(b, a);
+  EXPECT_EQ(c, b + 8);
+  EXPECT_EQ(arena.bytes_used(), 10u);
+  EXPECT_EQ(arena.chunk_count(), 1u);
+  arena.deallocate(b, 8);
+  EXPECT_EQ(arena.bytes_used(), 10u);
+}
+
+TEST(ArenaTest, GrowsAndReleases) {
+  Arena arena(256);
+  for (int i = 0; i < 100; ++i) arena.allocate(64);
+  EXPECT_GT(arena.chunk_count(), 1u);
+  void *big = arena.allocate(10000);  // larger than a chunk
+  std::memset(big, 1, 10000);
+  EXPECT_GE(arena.bytes_reserved(), 10000u);
+  arena.release();
+  EXPECT_EQ(arena.chunk_count(), 0u);
+  EXPECT_EQ(arena.bytes_used(), 0u);
+  EXPECT_NE(arena.allocate(16), nullptr);
+}
+
+// the padding of an aligned request can run past the end of a chunk whose
+// size is not a multiple of the alignment
+TEST(ArenaTest, PaddingPastUnalignedChunkEnd) {
+  Arena odd(100);
+  odd.allocate(97, 1);
+  char *p = static_cast<char *>(odd.allocate(8, 8));
+  EXPECT_EQ(odd.chunk_count(), 2u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 8, 0u);
+  std::memset(p, 0, 8);
+
+  Arena arena(4096);
+  arena.allocate(5000, 1);  // a chunk of its own, sized 5001
+  p = static_cast<char *>(arena.allocate(8, 8));
+  EXPECT_EQ(arena.chunk_count(), 2u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 8, 0u);
+  std::memset(p, 0, 8);
+}
+
+TEST(ArenaTest, HugePageChunks) {
+  Arena arena(4096, true);
+  int *values = static_cast<int *>(arena.allocate(1000 * sizeof(int)));
+  for (int i = 0; i < 1000; ++i) values[i] = i;
+  EXPECT_EQ(values[999], 999);
+  EXPECT_EQ(arena.chunk_count(), 1u);
+#ifdef __linux__
+  EXPECT_EQ(arena.bytes_reserved() % Arena::kHugePageSize, 0u);
+#endif
+}
+
+TEST(ArenaTest, AllocatorsShareTheArena) {
+  Arena arena, other;
+  ArenaAllocator<int> a(&arena);
+  ArenaAllocator<double> b(a);
+  EXPECT_TRUE(a == b);
+  EXPECT_TRUE(a != ArenaAllocator<int>(&other));
+  EXPECT_TRUE(releases_in_bulk<ArenaAllocator<int>>::value);
+  EXPECT_FALSE(releases_in_bulk<std::allocator<int>>::value);
+}
+
+TEST(ArenaTest, MapNodesInArena) {
+  Arena arena;
+  const char *base = static_cast<char *>(arena.allocate(1, 1));
+  ArenaMap<int, int> m(&arena);
+  for (int i = 0; i < 1000; ++i) m[i] = i * 2;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    ASSERT_TRUE(inside(arena, &(*it), base));
+  }
+  EXPECT_EQ(m.at(500), 1000);
+  EXPECT_EQ(arena.chunk_count(), 1u);
+  size_t used = arena.bytes_used();
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  m[1] = 1;  // still usable, new nodes come after the old ones
+  EXPECT_GT(arena.bytes_used(), used);
+  EXPECT_EQ(m.Size(), 1u);
+}
+
+TEST(ArenaTest, SetAndMultiset) {
+  Arena arena;
+  ArenaSet<int> s({5, 1, 3, 1}, &arena);
+  EXPECT_EQ(s.size(), 3u);
+  ArenaSet<int> copy(s);  // copies stay in the same arena
+  EXPECT_EQ(copy.get_allocator().arena(), &arena);
+  copy.insert(7);
+  s.merge(copy);
+  EXPECT_EQ(s.size(), 4u);
+  ArenaMultiset<int> ms(&arena);
+  for (int i = 0; i < 100; ++i) ms.insert(i % 10);
+  EXPECT_EQ(ms.count(3), 10u);
+  ms.erase(ms.find(3));
+  EXPECT_EQ(ms.count(3), 9u);
+}
+
+TEST(ArenaTest, AcrossArenasCopies) {
+  Arena a1, a2;
+  ArenaSet<int> s1({1, 2}, &a1);
+  ArenaSet<int> s2({3}, &a2);
+  s1.merge(s2);
+  EXPECT_EQ(s1.size(), 3u);
+  s2 = std::move(s1);
+  EXPECT_EQ(s2.get_allocator().arena(), &a2);
+  EXPECT_TRUE(s2.contains(1));
+  a1.release();  // nothing in s2 points into a1 any more
+  EXPECT_EQ(s2.size(), 3u);
+}
+
+TEST(ArenaTest, ListNodesInArena) {
+  Arena arena;
+  const char *base = static_cast<char *>(arena.allocate(1, 1));
+  ArenaList<int> l(&arena);
+  for (int i = 0; i < 100; ++i) l.push_back(i);
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    ASSERT_TRUE(inside(arena, &(*it), base));
+  }
+  l.pop_front();
+  EXPECT_EQ(l.front(), 1);
+  l.clear();
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.begin(), l.end());
+  l.push_front(7);
+  l.push_back(8);
+  EXPECT_EQ(l.size(), 2u);
+  EXPECT_EQ(l.back(), 8);
+}
+
+TEST(ArenaTest, NonTrivialValuesStillDestroyed) {
+  // strings keep their buffers on the heap, so skipping their destructors
+  // would show up as leaks
+  Arena arena;
+  ArenaMap<int, std::string> m(&arena);
+  ArenaList<std::string> l(&arena);
+  for (int i = 0; i < 100; ++i) {
+    m[i] = std::string(64, 'a' + i % 26);
+    l.push_back(std::string(64, 'a' + i % 26));
+  }
+  m.clear();
+  l.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(l.empty());
+}
+}  // namespace s21
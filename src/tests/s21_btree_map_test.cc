@@ -0,0 +1,193 @@
+#include "../s21_btree_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+namespace s21 {
+// 64-byte nodes hold a handful of keys, so small tests already build deep
+// trees and go through every split, borrow and merge
+using SmallNodeMap = BTreeMap<int, int, 64>;
+
+template <typename MapType>
+static void expect_same(const MapType &m, const std::map<int, int> &expected) {
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto const &item : expected) {
+    ASSERT_NE(it, m.end());
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_EQ(it, m.end());
+}
+
+TEST(BTreeMapTest, DefaultConstructor) {
+  BTreeMap<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0u);
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_EQ(m.find(1), nullptr);
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.erase(1), 0u);
+  EXPECT_EQ(m.lower_bound(1), m.end());
+}
+
+TEST(BTreeMapTest, InitializerListAndAccess) {
+  BTreeMap<std::string, int> m = {{"one", 1}, {"two", 2}, {"one", 3}};
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_EQ(*m.find("two"), 2);
+  EXPECT_THROW(m.at("three"), std::out_of_range);
+  m["three"] = 3;
+  m["three"] += 1;
+  EXPECT_EQ(m.at("three"), 4);
+  const auto &cm = m;
+  EXPECT_EQ(cm.at("two"), 2);
+  EXPECT_THROW(cm.at("four"), std::out_of_range);
+}
+
+TEST(BTreeMapTest, InsertAndAssign) {
+  BTreeMap<int, std::string> m;
+  auto result = m.insert(1, "a");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->second, "a");
+  result = m.insert({1, "b"});
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "a");
+  result = m.insert_or_assign(1, "c");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "c");
+  (*result.first).second = "d";
+  EXPECT_EQ(m.at(1), "d");
+}
+
+TEST(BTreeMapTest, AscendingLoadAndScan) {
+  SmallNodeMap m;
+  const int n = 20000;
+  for (int i = 0; i < n; ++i) m.insert(i, i * 2);
+  EXPECT_EQ(m.size(), static_cast<size_t>(n));
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++expected) {
+    ASSERT_EQ((*it).first, expected);
+    ASSERT_EQ((*it).second, expected * 2);
+  }
+  EXPECT_EQ(expected, n);
+  auto it = m.end();
+  for (int i = n - 1; i >= 0; --i) ASSERT_EQ((--it)->first, i);
+  EXPECT_EQ(it, m.begin());
+}
+
+TEST(BTreeMapTest, RandomAgainstStd) {
+  std::mt19937 gen(21);
+  for (int range : {50, 500, 5000}) {
+    SmallNodeMap m;
+    std::map<int, int> expected;
+    for (int i = 0; i < 30000; ++i) {
+      int key = static_cast<int>(gen() % range);
+      switch (gen() % 3) {
+        case 0:
+          m.insert_or_assign(key, i);
+          expected[key] = i;
+          break;
+        case 1:
+          ASSERT_EQ(m.erase(key), expected.erase(key));
+          break;
+        default:
+          ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+      }
+    }
+    expect_same(m, expected);
+    // drain through iterators, which takes every merge down to the root
+    while (!expected.empty()) {
+      auto victim = std::next(expected.begin(), gen() % expected.size());
+      m.erase(m.lower_bound(victim->first));
+      expected.erase(victim);
+    }
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+  }
+}
+
+TEST(BTreeMapTest, Bounds) {
+  SmallNodeMap m;
+  for (int i = 0; i < 1000; i += 10) m[i] = i;
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_EQ(m.lower_bound(-5)->first, 0);
+  EXPECT_EQ(m.lower_bound(991), m.end());
+  EXPECT_EQ(m.upper_bound(990), m.end());
+  const SmallNodeMap &cm = m;
+  int sum = 0;
+  for (auto it = cm.lower_bound(100); it != cm.upper_bound(150); ++it) {
+    sum += it->second;
+  }
+  EXPECT_EQ(sum, 100 + 110 + 120 + 130 + 140 + 150);
+}
+
+TEST(BTreeMapTest, CopyMoveSwap) {
+  SmallNodeMap m;
+  for (int i = 0; i < 500; ++i) m[i] = -i;
+  SmallNodeMap copy(m);
+  copy[1000] = 1;
+  EXPECT_EQ(m.size(), 500u);
+  EXPECT_EQ(copy.size(), 501u);
+  EXPECT_EQ(copy.at(499), -499);
+  EXPECT_EQ((--copy.end())->first, 1000);
+  SmallNodeMap moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 501u);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 501u);
+  m.swap(moved);
+  EXPECT_EQ(m.size(), 501u);
+  EXPECT_EQ(moved.size(), 500u);
+  moved = std::move(m);
+  EXPECT_EQ(moved.size(), 501u);
+}
+
+TEST(BTreeMapTest, MergeMovesMissingKeys) {
+  BTreeMap<int, std::string> m = {{1, "a"}, {2, "b"}};
+  BTreeMap<int, std::string> other = {{2, "x"}, {3, "c"}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.at(2), "x");
+  m.merge(m);
+  EXPECT_EQ(m.size(), 3u);
+}
+
+TEST(BTreeMapTest, InsertManyReturnsLivePositions) {
+  BTreeMap<int, char, 64> m;
+  for (int i = 0; i < 20; ++i) m[i * 2] = 'x';
+  auto result = m.insert_many(std::pair<const int, char>{5, 'a'},
+                              std::pair<const int, char>{7, 'b'},
+                              std::pair<const int, char>{5, 'c'},
+                              std::pair<const int, char>{9, 'd'});
+  ASSERT_EQ(result.size(), 4u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_EQ(result[0].first->second, 'a');
+  EXPECT_EQ(result[1].first->second, 'b');
+  EXPECT_EQ(result[2].first->second, 'a');
+  EXPECT_EQ(result[3].first->second, 'd');
+}
+
+TEST(BTreeMapTest, KeysFromTheMapItself) {
+  BTreeMap<std::string, std::string, 64> m;
+  for (int i = 0; i < 200; ++i) m[std::to_string(i)] = std::to_string(i);
+  // both arguments point into a full leaf that the insert splits
+  for (int i = 0; i < 200; ++i) {
+    auto it = m.lower_bound(std::to_string(i));
+    m.insert(it->first + "!", it->second);
+  }
+  EXPECT_EQ(m.size(), 400u);
+  EXPECT_EQ(m.at("42!"), "42");
+  m.erase(m.begin()->first);
+  EXPECT_EQ(m.size(), 399u);
+}
+}  // namespace s21
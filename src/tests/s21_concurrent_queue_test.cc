@@ -0,0 +1,113 @@
+#include "../s21_concurrent_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace s21 {
+TEST(ConcurrentQueueTest, FifoAndBounds) {
+  ConcurrentQueue<int> q(3);
+  EXPECT_EQ(q.capacity(), 4u);
+  EXPECT_TRUE(q.empty_approx());
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(4));
+  EXPECT_EQ(q.size_approx(), 4u);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(ConcurrentQueueTest, WrapsAround) {
+  ConcurrentQueue<int> q(2);
+  int value = 0;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(q.try_push(i));
+    ASSERT_TRUE(q.try_pop(value));
+    ASSERT_EQ(value, i);
+  }
+}
+
+TEST(ConcurrentQueueTest, OwnsNonTrivialValues) {
+  ConcurrentQueue<std::string> q(8);
+  std::string moved(100, 'm');
+  EXPECT_TRUE(q.try_push(std::string(50, 'a')));
+  EXPECT_TRUE(q.try_push(moved));
+  EXPECT_TRUE(q.try_emplace(3, 'c'));
+  std::string out;
+  ASSERT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, std::string(50, 'a'));
+  // the other two are destroyed with the queue
+}
+
+TEST(ConcurrentQueueTest, BulkIsPartialWhenFull) {
+  ConcurrentQueue<int> q(8);
+  std::vector<int> in = {0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(q.push_bulk(in.begin(), in.end()), 6u);
+  EXPECT_EQ(q.push_bulk(in.begin(), in.end()), 2u);
+  int out[16] = {};
+  EXPECT_EQ(q.pop_bulk(out, 5), 5u);
+  EXPECT_EQ(q.pop_bulk(out + 5, 16), 3u);
+  int expected[] = {0, 1, 2, 3, 4, 5, 0, 1};
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(out[i], expected[i]);
+  EXPECT_EQ(q.pop_bulk(out, 16), 0u);
+  EXPECT_EQ(q.push_bulk(in.begin(), in.begin()), 0u);
+}
+
+// Each producer pushes its own tagged range; every value must come out
+// exactly once and, per producer, in order.
+TEST(ConcurrentQueueTest, ManyProducersManyConsumers) {
+  const int producers = 4;
+  const int consumers = 4;
+  const int per_producer = 20000;
+  ConcurrentQueue<int> q(64);
+  std::vector<std::thread> threads;
+  std::vector<std::vector<int>> seen(consumers);
+  std::atomic<int> popped{0};
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (int i = 0; i < per_producer; ++i) {
+        int value = p * per_producer + i;
+        if (i % 3 == 0) {
+          while (q.push_bulk(&value, &value + 1) == 0) {
+            std::this_thread::yield();
+          }
+        } else {
+          while (!q.try_push(value)) std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, c] {
+      int buffer[8];
+      while (popped.load() < producers * per_producer) {
+        size_t n = q.pop_bulk(buffer, 8);
+        if (n == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        seen[c].insert(seen[c].end(), buffer, buffer + n);
+        popped += static_cast<int>(n);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::vector<int> count(producers * per_producer, 0);
+  for (const auto& values : seen) {
+    std::vector<int> last(producers, -1);
+    for (int value : values) {
+      ++count[value];
+      int producer = value / per_producer;
+      ASSERT_LT(last[producer], value);
+      last[producer] = value;
+    }
+  }
+  for (int c : count) ASSERT_EQ(c, 1);
+  EXPECT_TRUE(q.empty_approx());
+}
+}  // namespace s21
@@ -0,0 +1,173 @@
+#include "../s21_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace s21 {
+TEST(FlatMapTest, DefaultConstructor) {
+  FlatMap<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0u);
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_EQ(m.find(1), nullptr);
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_EQ(m.erase(1), 0u);
+}
+
+TEST(FlatMapTest, InitializerListAndAccess) {
+  FlatMap<std::string, int> m = {{"one", 1}, {"two", 2}, {"one", 3}};
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_EQ(*m.find("two"), 2);
+  EXPECT_THROW(m.at("three"), std::out_of_range);
+  m["three"] = 3;
+  m["three"] += 1;
+  EXPECT_EQ(m.at("three"), 4);
+  const auto &cm = m;
+  EXPECT_EQ(cm.at("two"), 2);
+  EXPECT_THROW(cm.at("four"), std::out_of_range);
+  EXPECT_EQ(m.begin()->first, "one");
+  EXPECT_EQ((m.end() - 1)->first, "two");
+}
+
+struct CountedDefault {
+  static inline int built = 0;
+  CountedDefault() { ++built; }
+  int value = 0;
+};
+
+TEST(FlatMapTest, SubscriptBuildsOnlyOnMiss) {
+  FlatMap<int, CountedDefault> m;
+  CountedDefault::built = 0;
+  m[1].value = 10;
+  m[2].value = 20;
+  EXPECT_EQ(CountedDefault::built, 2);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(m[1 + i % 2].value, 10 + i % 2 * 10);
+  EXPECT_EQ(CountedDefault::built, 2);
+}
+
+TEST(FlatMapTest, InsertAndAssign) {
+  FlatMap<int, std::string> m;
+  auto result = m.insert(1, "a");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->second, "a");
+  result = m.insert({1, "b"});
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "a");
+  result = m.insert_or_assign(1, "c");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "c");
+  result = m.insert_or_assign(0, "z");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first, m.begin());
+  m.erase(m.begin());
+  EXPECT_EQ(m.size(), 1u);
+  EXPECT_EQ(m.begin()->first, 1);
+}
+
+TEST(FlatMapTest, Bounds) {
+  FlatMap<int, int> m;
+  for (int i = 0; i < 1000; i += 10) m[i] = i;
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_EQ(m.lower_bound(991), m.end());
+  const FlatMap<int, int> &cm = m;
+  int sum = 0;
+  for (auto it = cm.lower_bound(100); it != cm.upper_bound(150); ++it) {
+    sum += it->second;
+  }
+  EXPECT_EQ(sum, 100 + 110 + 120 + 130 + 140 + 150);
+  auto range = cm.equal_range(500);
+  ASSERT_EQ(range.second - range.first, 1);
+  EXPECT_EQ(range.first->second, 500);
+}
+
+TEST(FlatMapTest, FromUnsortedKeepsFirstValue) {
+  std::vector<std::pair<int, char>> input = {
+      {3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'}, {1, 'e'}};
+  auto m = FlatMap<int, char>::from_unsorted(input.begin(), input.end());
+  ASSERT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.at(1), 'b');
+  EXPECT_EQ(m.at(2), 'd');
+  EXPECT_EQ(m.at(3), 'a');
+  m.shrink_to_fit();
+  EXPECT_EQ(m.capacity(), 3u);
+}
+
+TEST(FlatMapTest, InsertMany) {
+  FlatMap<int, char> m = {{2, 'x'}, {4, 'x'}};
+  auto result = m.insert_many(std::pair<int, char>{5, 'a'},
+                              std::pair<int, char>{4, 'b'},
+                              std::pair<int, char>{5, 'c'},
+                              std::pair<int, char>{1, 'd'});
+  ASSERT_EQ(result.size(), 4u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_TRUE(result[3].second);
+  EXPECT_EQ(result[0].first->second, 'a');
+  EXPECT_EQ(result[1].first->second, 'x');
+  EXPECT_EQ(result[2].first->second, 'a');
+  EXPECT_EQ(result[3].first->second, 'd');
+  EXPECT_EQ(m.size(), 4u);
+}
+
+TEST(FlatMapTest, MergeMovesMissingKeys) {
+  FlatMap<int, std::string> m = {{1, "a"}, {2, "b"}};
+  FlatMap<int, std::string> other = {{2, "x"}, {3, "c"}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.at(2), "x");
+}
+
+TEST(FlatMapTest, CopyMoveSwap) {
+  FlatMap<int, std::string> m = {{1, "a"}, {2, "b"}};
+  FlatMap<int, std::string> copy(m);
+  copy[3] = "c";
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(copy.size(), 3u);
+  FlatMap<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.at(3), "c");
+  copy = m;
+  EXPECT_EQ(copy.at(2), "b");
+  m.swap(moved);
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(moved.size(), 2u);
+  moved = std::move(m);
+  EXPECT_EQ(moved.size(), 3u);
+}
+
+TEST(FlatMapTest, RandomAgainstStd) {
+  std::mt19937 gen(21);
+  FlatMap<int, int> m;
+  std::map<int, int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 500);
+    switch (gen() % 3) {
+      case 0:
+        m.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      case 1:
+        ASSERT_EQ(m.erase(key), expected.erase(key));
+        break;
+      default:
+        ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (auto const &item : expected) {
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(it->second, item.second);
+    ++it;
+  }
+}
+}  // namespace s21
@@ -0,0 +1,152 @@
+#include "../s21_flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+namespace s21 {
+TEST(FlatSetTest, DefaultConstructor) {
+  FlatSet<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0u);
+  EXPECT_EQ(s.begin(), s.end());
+  EXPECT_EQ(s.find(1), s.end());
+  EXPECT_FALSE(s.contains(1));
+  EXPECT_EQ(s.erase(1), 0u);
+  EXPECT_EQ(s.lower_bound(1), s.end());
+}
+
+TEST(FlatSetTest, InitializerListSortsAndDedupes) {
+  FlatSet<int> s = {5, 1, 4, 1, 3, 5, 2};
+  std::vector<int> expected = {1, 2, 3, 4, 5};
+  EXPECT_EQ(std::vector<int>(s.begin(), s.end()), expected);
+}
+
+TEST(FlatSetTest, InsertEraseFind) {
+  FlatSet<std::string> s;
+  EXPECT_TRUE(s.insert("b").second);
+  EXPECT_TRUE(s.insert("d").second);
+  auto result = s.insert("a");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first, s.begin());
+  result = s.insert("b");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, "b");
+  EXPECT_EQ(s.size(), 3u);
+  EXPECT_EQ(*s.find("d"), "d");
+  EXPECT_EQ(s.find("c"), s.end());
+  auto next = s.erase(s.find("b"));
+  EXPECT_EQ(*next, "d");
+  EXPECT_EQ(s.erase("a"), 1u);
+  EXPECT_EQ(s.erase("a"), 0u);
+  EXPECT_EQ(s.size(), 1u);
+  EXPECT_EQ(*s.begin(), "d");
+}
+
+TEST(FlatSetTest, Bounds) {
+  FlatSet<int> s = {10, 20, 30};
+  EXPECT_EQ(*s.lower_bound(20), 20);
+  EXPECT_EQ(*s.lower_bound(21), 30);
+  EXPECT_EQ(*s.upper_bound(20), 30);
+  EXPECT_EQ(s.upper_bound(30), s.end());
+  auto range = s.equal_range(20);
+  EXPECT_EQ(range.second - range.first, 1);
+  range = s.equal_range(25);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(*range.first, 30);
+}
+
+TEST(FlatSetTest, FromUnsortedKeepsFirstOfEqualKeys) {
+  // compares by the first member only, so the kept element is observable
+  struct Tagged {
+    int key;
+    int tag;
+    bool operator<(const Tagged &other) const { return key < other.key; }
+  };
+  std::vector<Tagged> input = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4}};
+  auto s = FlatSet<Tagged>::from_unsorted(input.begin(), input.end());
+  ASSERT_EQ(s.size(), 3u);
+  EXPECT_EQ(s.begin()[0].tag, 1);
+  EXPECT_EQ(s.begin()[1].tag, 3);
+  EXPECT_EQ(s.begin()[2].tag, 0);
+  // elements already stored win over new ones
+  std::vector<Tagged> more = {{2, 9}, {0, 9}};
+  s.insert(more.begin(), more.end());
+  ASSERT_EQ(s.size(), 4u);
+  EXPECT_EQ(s.begin()[0].tag, 9);
+  EXPECT_EQ(s.begin()[2].tag, 3);
+}
+
+TEST(FlatSetTest, InsertMany) {
+  FlatSet<int> s = {2, 4};
+  auto result = s.insert_many(3, 4, 1, 3);
+  ASSERT_EQ(result.size(), 4u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_TRUE(result[2].second);
+  EXPECT_FALSE(result[3].second);
+  EXPECT_EQ(*result[0].first, 3);
+  EXPECT_EQ(*result[1].first, 4);
+  EXPECT_EQ(*result[2].first, 1);
+  EXPECT_EQ(result[3].first, result[0].first);
+  EXPECT_EQ(s.size(), 4u);
+}
+
+TEST(FlatSetTest, CopyMoveSwap) {
+  FlatSet<int> s = {1, 2, 3};
+  FlatSet<int> copy(s);
+  copy.insert(4);
+  EXPECT_EQ(s.size(), 3u);
+  EXPECT_EQ(copy.size(), 4u);
+  FlatSet<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4u);
+  copy = s;
+  EXPECT_EQ(copy.size(), 3u);
+  s.swap(moved);
+  EXPECT_EQ(s.size(), 4u);
+  EXPECT_EQ(moved.size(), 3u);
+  moved = std::move(s);
+  EXPECT_EQ(moved.size(), 4u);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(FlatSetTest, MergeLeavesDuplicatesInOther) {
+  FlatSet<int> s = {1, 3, 5};
+  FlatSet<int> other = {2, 3, 4, 5, 6};
+  s.merge(other);
+  std::vector<int> expected = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(std::vector<int>(s.begin(), s.end()), expected);
+  expected = {3, 5};
+  EXPECT_EQ(std::vector<int>(other.begin(), other.end()), expected);
+  s.merge(s);
+  EXPECT_EQ(s.size(), 6u);
+}
+
+TEST(FlatSetTest, RandomAgainstStd) {
+  std::mt19937 gen(21);
+  FlatSet<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 500);
+    switch (gen() % 3) {
+      case 0:
+        ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+        break;
+      case 1:
+        ASSERT_EQ(s.erase(key), expected.erase(key));
+        break;
+      default:
+        ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+    }
+  }
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+  std::vector<int> batch(1000);
+  for (int &key : batch) key = static_cast<int>(gen() % 2000);
+  s.insert(batch.begin(), batch.end());
+  expected.insert(batch.begin(), batch.end());
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+}
+}  // namespace s21
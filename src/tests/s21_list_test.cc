@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <vector>
 // #include <list>
 // #include <iterator>
 // #include <queue>
 #include "../s21_list.h"
+#include "../s21_pool.h"
 
 // using namespace std;
 
@@ -108,6 +112,58 @@ TEST(Suite_List_Modifiers, Sort) {
   EXPECT_EQ(l1.size(), l2.size());
 }
 
+TEST(Suite_List_Modifiers, Sort_Random) {
+  std::list<int> l1;
+  s21::List<int> l2;
+  srand(21);
+  for (int i = 0; i < 10000; ++i) {
+    int value = rand() % 1000;
+    l1.push_back(value);
+    l2.push_back(value);
+  }
+  l1.sort();
+  l2.Sort();
+  EXPECT_EQ(l1.size(), l2.size());
+  auto it = l2.begin();
+  for (int value : l1) {
+    EXPECT_EQ(value, *it);
+    ++it;
+  }
+  EXPECT_EQ(it, l2.end());
+  EXPECT_EQ(l1.back(), l2.back());
+}
+
+TEST(Suite_List_Modifiers, Sort_Comparator) {
+  s21::List<int> l = {3, 1, 4, 1, 5, 9, 2, 6};
+  l.Sort(std::greater<int>());
+  int expected[] = {9, 6, 5, 4, 3, 2, 1, 1};
+  int i = 0;
+  for (auto it = l.begin(); it != l.end(); ++it) EXPECT_EQ(*it, expected[i++]);
+  auto last = l.end();
+  --last;
+  EXPECT_EQ(*last, 1);
+}
+
+TEST(Suite_List_Modifiers, Sort_StableAndRelinks) {
+  s21::List<std::pair<int, int>> l;
+  for (int i = 0; i < 100; ++i) l.push_back({i % 7, i});
+  auto first = l.begin().getIterPointer();
+  auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  };
+  l.Sort(by_key);
+  auto prev = *l.begin();
+  bool found_first = false;
+  for (auto it = l.begin(); it != l.end(); ++it) {
+    found_first = found_first || it.getIterPointer() == first;
+    EXPECT_TRUE(prev.first < (*it).first ||
+                (prev.first == (*it).first && prev.second <= (*it).second));
+    prev = *it;
+  }
+  EXPECT_TRUE(found_first);
+  EXPECT_EQ(l.size(), 100U);
+}
+
 TEST(Suite_List_Modifiers, Merge) {
   std::list<int> a1 = {1, 2, 3};
   std::list<int> a2 = {3, 4, 5, 6};
@@ -121,6 +177,58 @@ TEST(Suite_List_Modifiers, Merge) {
   EXPECT_EQ(a1.size(), b1.size());
 }
 
+TEST(Suite_List_Modifiers, Merge_Interleaved) {
+  std::list<int> a1 = {1, 3, 5, 7, 9};
+  std::list<int> a2 = {0, 2, 3, 4, 10, 11};
+  a1.merge(a2);
+  s21::List<int> b1 = {1, 3, 5, 7, 9};
+  s21::List<int> b2 = {0, 2, 3, 4, 10, 11};
+  auto moved = b2.begin().getIterPointer();
+  b1.Merge(b2);
+  EXPECT_EQ(b2.size(), 0U);
+  EXPECT_TRUE(b2.begin() == b2.end());
+  EXPECT_EQ(b1.begin().getIterPointer(), moved);
+  EXPECT_EQ(a1.size(), b1.size());
+  auto it = b1.begin();
+  for (int value : a1) {
+    EXPECT_EQ(value, *it);
+    ++it;
+  }
+  auto last = b1.end();
+  --last;
+  EXPECT_EQ(*last, 11);
+  b2.push_back(12);
+  b1.Merge(b2);
+  EXPECT_EQ(b1.back(), 12);
+}
+
+TEST(Suite_List_Modifiers, Merge_IntoEmptyAndStable) {
+  using Item = std::pair<int, char>;
+  auto by_key = [](const Item& a, const Item& b) { return a.first < b.first; };
+  s21::List<Item> l1;
+  s21::List<Item> l2 = {{1, 'b'}, {2, 'b'}};
+  l1.Merge(l2, by_key);
+  EXPECT_EQ(l1.size(), 2U);
+  s21::List<Item> l3 = {{1, 'c'}, {3, 'c'}};
+  l1.Merge(l3, by_key);
+  Item expected[] = {{1, 'b'}, {1, 'c'}, {2, 'b'}, {3, 'c'}};
+  int i = 0;
+  for (auto it = l1.begin(); it != l1.end(); ++it) {
+    EXPECT_EQ(*it, expected[i++]);
+  }
+}
+
+TEST(Suite_List_Modifiers, Merge_DifferentPools) {
+  s21::List<int, PoolAllocator<int>> l1 = {1, 4};
+  s21::List<int, PoolAllocator<int>> l2 = {2, 3, 5};
+  l1.Merge(l2);
+  EXPECT_EQ(l2.size(), 0U);
+  l2.push_back(6);
+  int expected = 1;
+  for (auto it = l1.begin(); it != l1.end(); ++it) EXPECT_EQ(*it, expected++);
+  EXPECT_EQ(expected, 6);
+}
+
 TEST(Suite_List_Modifiers, Swap) {
   std::list<int> a1 = {1, 2, 3};
   std::list<int> a2 = {3, 4, 5, 6};
@@ -303,6 +411,20 @@ TEST(Suite_List_modifier, erase) {
   EXPECT_EQ(l1.front(), l2.front());
   EXPECT_EQ(l1.size(), l2.size());
 }
+TEST(Suite_List_modifier, Erase_Relinks_Both_Ways) {
+  s21::List<int> l = {1, 2, 3, 4, 5};
+  auto it = l.begin();
+  ++it;
+  ++it;
+  l.erase(it);  // 3
+  auto four = ++(++l.begin());
+  l.insert(four, 7);  // before 4, through its pPrev
+  std::vector<int> backwards;
+  auto back = l.end();
+  while (back != l.begin()) backwards.push_back(*--back);
+  EXPECT_EQ(backwards, (std::vector<int>{5, 4, 7, 2, 1}));
+  EXPECT_EQ(l.size(), 5u);
+}
 TEST(Suite_List_modifier, Splice) {
   std::list<int> a1 = {1, 2, 3};
   std::list<int> a2 = {3, 4, 5, 6};
@@ -415,4 +537,84 @@ TEST(Suite_ListTest, EmplaceInt) {
   EXPECT_EQ(list.back(), 3);
 }
 
+TEST(Suite_List_Pool, PushPopReusesSlots) {
+  List<int, PoolAllocator<int, 4>> list;
+  for (int i = 0; i < 10; ++i) list.push_back(i);
+  EXPECT_EQ(list.size(), 10U);
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 9);
+  size_t chunks = list.get_allocator().pool()->chunk_count();
+  for (int round = 0; round < 100; ++round) {
+    list.pop_front();
+    list.push_back(round);
+  }
+  EXPECT_EQ(list.get_allocator().pool()->chunk_count(), chunks);
+  EXPECT_EQ(list.size(), 10U);
+  EXPECT_EQ(list.back(), 99);
+}
+
+TEST(Suite_List_Pool, CopyGetsOwnPool) {
+  List<std::string, PoolAllocator<std::string>> l1 = {"a", "b", "c"};
+  List<std::string, PoolAllocator<std::string>> l2(l1);
+  EXPECT_NE(l1.get_allocator(), l2.get_allocator());
+  l1.clear();
+  EXPECT_EQ(l2.size(), 3U);
+  EXPECT_EQ(l2.front(), "a");
+  EXPECT_EQ(l2.back(), "c");
+}
+
+TEST(Suite_List_Pool, SwapAndMove) {
+  List<int, PoolAllocator<int>> l1 = {1, 2, 3};
+  List<int, PoolAllocator<int>> l2 = {4, 5};
+  l1.Swap(l2);
+  EXPECT_EQ(l1.size(), 2U);
+  EXPECT_EQ(l2.back(), 3);
+  List<int, PoolAllocator<int>> l3 = std::move(l1);
+  EXPECT_EQ(l3.front(), 4);
+  EXPECT_EQ(l1.size(), 0U);
+}
+
+TEST(Suite_List_Pool, SlabPoolFreeList) {
+  SlabPool pool(2);
+  void* a = pool.allocate(24);
+  void* b = pool.allocate(24);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(pool.chunk_count(), 1U);
+  pool.deallocate(a, 24);
+  EXPECT_EQ(pool.allocate(24), a);
+  void* c = pool.allocate(24);
+  EXPECT_EQ(pool.chunk_count(), 2U);
+  void* big = pool.allocate(1000);
+  pool.deallocate(big, 1000);
+  pool.deallocate(b, 24);
+  pool.deallocate(c, 24);
+}
+
+
+TEST(Suite_List_Pmr, Nodes_From_Resource) {
+  alignas(std::max_align_t) char buf[2048];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::List<int> l(&r);
+  for (int i = 0; i < 20; ++i) l.push_back(i);
+  for (auto& value : l) {
+    char* p = reinterpret_cast<char*>(&value);
+    EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  }
+  EXPECT_EQ(l.size(), 20u);
+}
+
+TEST(Suite_List_Pmr, Splice_Across_Resources_Copies) {
+  std::pmr::monotonic_buffer_resource r1, r2;
+  s21::pmr::List<int> a({1, 2}, &r1);
+  s21::pmr::List<int> b({3, 4}, &r2);
+  a.Splice(a.end(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(a.back(), 4);
+  a.Swap(b);
+  EXPECT_EQ(b.size(), 4u);
+  EXPECT_EQ(b.get_allocator().resource(), &r2);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 TEST(map_test, constructorInit) {
   s21::Map<int, int> m1 = {{1, 1}, {1, 2}, {3, 3}, {4, 4}, {5, 5}};
@@ -464,3 +468,158 @@ TEST(map_test, operatorBrace) {
   m2.at(10) = 5;
   EXPECT_EQ(m1.at(10), m2.at(10));
 }
+
+TEST(map_test, bounds) {
+  s21::Map<int, char> m = {{1, 'a'}, {3, 'c'}, {5, 'e'}};
+  EXPECT_EQ((*m.lower_bound(3)).second, 'c');
+  EXPECT_EQ((*m.lower_bound(4)).second, 'e');
+  EXPECT_EQ((*m.upper_bound(3)).second, 'e');
+  EXPECT_EQ(m.upper_bound(5), m.end());
+  auto range = m.equal_range(1);
+  EXPECT_EQ((*range.first).first, 1);
+  EXPECT_EQ((*range.second).first, 3);
+  const s21::Map<int, char> &cm = m;
+  auto const_range = cm.equal_range(2);
+  EXPECT_EQ(const_range.first, const_range.second);
+  EXPECT_EQ((*cm.lower_bound(0)).first, 1);
+  EXPECT_EQ(cm.upper_bound(6), cm.end());
+}
+
+TEST(map_test, from_sorted_and_hint) {
+  std::vector<std::pair<int, char>> items = {{1, 'a'}, {2, 'b'}, {4, 'd'}};
+  auto m = s21::Map<int, char>::from_sorted(items.begin(), items.end());
+  EXPECT_EQ(m.Size(), 3u);
+  EXPECT_EQ(m.at(4), 'd');
+  auto it = m.insert(m.end(), {5, 'e'});
+  EXPECT_EQ((*it).second, 'e');
+  it = m.insert(m.begin(), {3, 'c'});
+  EXPECT_EQ((*it).first, 3);
+  it = m.insert(m.end(), {1, 'z'});
+  EXPECT_EQ((*it).second, 'a');
+  EXPECT_EQ(m.Size(), 5u);
+  s21::Map<int, char> copy(m);
+  EXPECT_EQ(copy.at(3), 'c');
+}
+
+TEST(map_test, extract_and_merge_move_nodes) {
+  s21::Map<int, std::string> m1 = {{1, "a"}, {2, "b"}};
+  s21::Map<int, std::string> m2 = {{2, "x"}, {3, "c"}};
+  const std::string *moved = &m2.at(3);
+  m1.merge(m2);
+  EXPECT_EQ(m1.Size(), 3u);
+  EXPECT_EQ(&m1.at(3), moved);
+  EXPECT_EQ(m1.at(2), "b");
+  EXPECT_EQ(m2.Size(), 1u);
+  EXPECT_EQ(m2.at(2), "x");
+
+  auto handle = m1.extract(1);
+  EXPECT_EQ(handle.key(), 1);
+  handle.key() = 10;
+  handle.mapped() = "j";
+  auto result = m1.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ((*result.position).first, 10);
+  EXPECT_FALSE(m1.contains(1));
+  result = m1.insert(m2.extract(m2.begin()));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.mapped(), "x");
+  EXPECT_TRUE(m2.empty());
+}
+
+TEST(map_test, pmrNodesFromResource) {
+  alignas(std::max_align_t) char buf[4096];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Map<int, int> m(&r);
+  for (int i = 0; i < 40; ++i) m[i] = -i;
+  EXPECT_EQ(m.Size(), 40u);
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    const char *p = reinterpret_cast<const char *>(&(*it));
+    EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  }
+  EXPECT_EQ(m.get_allocator().resource(), &r);
+}
+
+TEST(map_test, pmrAcrossResources) {
+  std::pmr::monotonic_buffer_resource r1, r2;
+  s21::pmr::Map<int, std::string> a({{1, "a"}, {2, "b"}}, &r1);
+  s21::pmr::Map<int, std::string> b({{2, "x"}, {3, "c"}}, &r2);
+  a.merge(b);
+  EXPECT_EQ(a.Size(), 3u);
+  EXPECT_EQ(a.at(3), "c");
+  EXPECT_EQ(b.at(2), "x");
+  a.swap(b);
+  EXPECT_EQ(a.get_allocator().resource(), &r1);
+  EXPECT_EQ(b.Size(), 3u);
+  b.insert(a.extract(a.begin()));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.Size(), 3u);
+  a = b;
+  EXPECT_EQ(a.get_allocator().resource(), &r1);
+  EXPECT_EQ(a.at(1), "a");
+}
+
+TEST(map_test, greaterCompare) {
+  s21::Map<int, char, std::greater<int>> m{{1, 'a'}, {3, 'c'}, {2, 'b'}};
+  EXPECT_EQ((*m.begin()).first, 3);
+  m[0] = 'z';
+  m[2] = 'x';
+  EXPECT_EQ(m.Size(), 4u);
+  EXPECT_EQ(m.at(2), 'x');
+  EXPECT_EQ((*m.lower_bound(1)).second, 'a');
+  EXPECT_EQ((*--m.end()).first, 0);
+}
+
+TEST(map_test, transparentLookup) {
+  s21::Map<std::string, int, std::less<>> m;
+  m["one"] = 1;
+  m["two"] = 2;
+  m["three"] = 3;
+  std::string_view key = "two";
+  ASSERT_NE(m.find(key), nullptr);
+  EXPECT_EQ(*m.find(key), 2);
+  EXPECT_EQ(m.find("four"), nullptr);
+  EXPECT_TRUE(m.contains("three"));
+  EXPECT_FALSE(m.contains(std::string_view("zero")));
+  EXPECT_EQ((*m.lower_bound("p")).first, "three");
+  EXPECT_EQ(m.upper_bound(key), m.end());
+  auto range = m.equal_range(key);
+  EXPECT_EQ((*range.first).second, 2);
+}
+
+TEST(map_test, latestEntriesFromTheBack) {
+  s21::Map<int, std::string> events;
+  for (int t = 0; t < 100; ++t) events.insert(t, "event " + std::to_string(t));
+  std::vector<int> latest;
+  for (auto it = events.rbegin(); it != events.rend() && latest.size() < 3;
+       ++it) {
+    latest.push_back(it->first);
+  }
+  EXPECT_EQ(latest, std::vector<int>({99, 98, 97}));
+  EXPECT_EQ((--events.end())->second, "event 99");
+  events.erase(--events.end());
+  EXPECT_EQ(events.rbegin()->first, 98);
+}
+
+TEST(map_test, frontAndBack) {
+  s21::Map<int, std::string> m = {{5, "five"}, {1, "one"}, {9, "nine"}};
+  EXPECT_EQ(m.front().first, 1);
+  EXPECT_EQ(m.back().second, "nine");
+  m.back().second = "last";
+  EXPECT_EQ(m.at(9), "last");
+  m.insert(0, "zero");
+  const s21::Map<int, std::string>& view = m;
+  EXPECT_EQ(view.front().second, "zero");
+  EXPECT_EQ(view.back().first, 9);
+}
+
+TEST(map_test, debugStatsForMonitoring) {
+  s21::Map<int, std::string> m;
+  for (int i = 0; i < 4096; ++i) m.insert(i, "value");
+  s21::TreeDebugStats stats = m.debug_stats();
+  EXPECT_EQ(stats.node_count, 4096u);
+  EXPECT_GT(stats.bytes_used, 4096 * sizeof(std::string));
+  // sorted inserts leave a red-black tree far from a 4096 long chain
+  EXPECT_LE(stats.height, 24u);
+  EXPECT_LT(m.sampled_depth(), 24.0);
+}
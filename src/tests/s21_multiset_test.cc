@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
 // Тесты конструкторов и деструктора
 
 TEST(MultisetTest, DefaultConstructor) {
@@ -355,4 +361,149 @@ TEST(MultisetTest, insert_manyEmpty) {
   auto [it, inserted] = result.front();
   EXPECT_TRUE(inserted);
   EXPECT_EQ(*it, 1);
-}
\ No newline at end of file
+}
+TEST(MultisetTest, nth_rank_count_range) {
+  s21::Multiset<int> s = {5, 1, 3, 3, 3, 7, 5};
+  EXPECT_EQ(*s.nth(0), 1);
+  EXPECT_EQ(*s.nth(3), 3);
+  EXPECT_EQ(*s.nth(4), 5);
+  EXPECT_EQ(s.nth(7), s.end());
+  EXPECT_EQ(s.rank(3), 1);
+  EXPECT_EQ(s.rank(4), 4);
+  EXPECT_EQ(s.count_range(3, 6), 5);
+  EXPECT_EQ(s.count(3), 3);
+  s.erase(s.find(3));
+  EXPECT_EQ(s.count(3), 2);
+  EXPECT_EQ(s.rank(5), 3);
+  s21::Multiset<int> other = {3, 8};
+  s.merge(other);
+  EXPECT_EQ(s.count_range(3, 9), 7);
+  EXPECT_EQ(*s.nth(7), 8);
+}
+TEST(MultisetTest, equal_range_duplicates) {
+  s21::Multiset<int> s;
+  std::multiset<int> expected;
+  for (int i = 0; i < 300; ++i) {
+    s.insert(i % 17);
+    expected.insert(i % 17);
+  }
+  for (int key = -1; key <= 17; ++key) {
+    auto range = s.equal_range(key);
+    auto std_range = expected.equal_range(key);
+    ASSERT_EQ(range.first, s.lower_bound(key));
+    ASSERT_EQ(range.second, s.upper_bound(key));
+    int n = 0;
+    for (auto it = range.first; it != range.second; ++it, ++n) {
+      ASSERT_EQ(*it, key);
+    }
+    ASSERT_EQ(n, std::distance(std_range.first, std_range.second));
+    ASSERT_EQ(s.rank(key), std::distance(expected.begin(), std_range.first));
+  }
+}
+TEST(MultisetTest, extract_and_merge_move_nodes) {
+  s21::Multiset<int> s = {1, 2, 2, 3};
+  s21::Multiset<int> other = {2, 4};
+  const int *moved = &*other.find(4);
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.size(), 6);
+  EXPECT_EQ(s.count(2), 3);
+  EXPECT_EQ(&*s.find(4), moved);
+  auto handle = s.extract(2);
+  EXPECT_EQ(handle.value(), 2);
+  EXPECT_EQ(s.count(2), 2);
+  auto it = other.insert(std::move(handle));
+  EXPECT_EQ(*it, 2);
+  other.insert(s.extract(s.begin()));
+  EXPECT_EQ(other.size(), 2);
+  EXPECT_EQ(*other.begin(), 1);
+}
+
+TEST(MultisetTest, PmrNodesFromResource) {
+  alignas(std::max_align_t) char buf[4096];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Multiset<int> s(&r);
+  for (int i = 0; i < 40; ++i) s.insert(i % 10);
+  EXPECT_EQ(s.size(), 40);
+  EXPECT_EQ(s.count(3), 4);
+  for (const int &value : s) {
+    const char *p = reinterpret_cast<const char *>(&value);
+    EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  }
+}
+
+TEST(MultisetTest, PmrAcrossResources) {
+  std::pmr::monotonic_buffer_resource r1, r2;
+  s21::pmr::Multiset<int> a({1, 1, 2}, &r1);
+  s21::pmr::Multiset<int> b({1, 3}, &r2);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 5);
+  EXPECT_TRUE(b.empty());
+  b = std::move(a);
+  EXPECT_EQ(b.get_allocator().resource(), &r2);
+  EXPECT_EQ(b.count(1), 3);
+}
+
+TEST(MultisetTest, SortedKeysWithRepeats) {
+  const int n = 1000000;
+  s21::Multiset<int> ms;
+  for (int i = 0; i < n; ++i) ms.insert(i / 4);
+  ASSERT_EQ(ms.size(), static_cast<size_t>(n));
+  EXPECT_EQ(ms.count(n / 8), 4u);
+  s21::Multiset<int> copy(ms);
+  EXPECT_EQ(copy.size(), ms.size());
+  EXPECT_EQ(*copy.begin(), 0);
+  ms.erase(ms.find(0));
+  EXPECT_EQ(ms.count(0), 3u);
+  EXPECT_EQ(copy.count(0), 4u);
+}
+
+TEST(MultisetTest, CustomAndTransparentCompare) {
+  s21::Multiset<int, std::greater<int>> desc{1, 3, 3, 2};
+  EXPECT_EQ(*desc.begin(), 3);
+  EXPECT_EQ(desc.count(3), 2u);
+  EXPECT_EQ(*desc.upper_bound(3), 2);
+  s21::Multiset<std::string, std::less<>> words{"b", "a", "b", "c"};
+  std::string_view key = "b";
+  EXPECT_EQ(words.count(key), 2u);
+  EXPECT_TRUE(words.contains("a"));
+  EXPECT_FALSE(words.contains("d"));
+  EXPECT_EQ(*words.find(key), "b");
+  EXPECT_EQ(*words.lower_bound("b"), "b");
+  EXPECT_EQ(*words.upper_bound("b"), "c");
+  auto range = words.equal_range(key);
+  EXPECT_EQ(std::distance(range.first, range.second), 2);
+}
+
+TEST(MultisetTest, ReverseIteration) {
+  s21::Multiset<int> ms{2, 5, 5, 1, 3};
+  std::vector<int> values(ms.rbegin(), ms.rend());
+  EXPECT_EQ(values, std::vector<int>({5, 5, 3, 2, 1}));
+  auto it = ms.end();
+  EXPECT_EQ(*--it, 5);
+  EXPECT_EQ(*--it, 5);
+  EXPECT_EQ(*--it, 3);
+  ms.insert(9);
+  EXPECT_EQ(*ms.rbegin(), 9);
+}
+
+TEST(MultisetTest, FrontAndBack) {
+  s21::Multiset<int> ms{2, 5, 5, 1, 1, 3};
+  EXPECT_EQ(ms.front(), 1);
+  EXPECT_EQ(ms.back(), 5);
+  ms.erase(ms.begin());
+  ms.erase(ms.begin());
+  EXPECT_EQ(ms.front(), 2);
+  ms.insert(7);
+  EXPECT_EQ(ms.back(), 7);
+}
+
+TEST(MultisetTest, DebugStatsCountRepeats) {
+  s21::Multiset<int> ms;
+  for (int i = 0; i < 1000; ++i) ms.insert(i % 3);
+  s21::TreeDebugStats stats = ms.debug_stats();
+  EXPECT_EQ(stats.node_count, 1000u);
+  EXPECT_LE(stats.height, 20u);
+  EXPECT_GT(ms.sampled_depth(), 0.0);
+}
@@ -0,0 +1,238 @@
+#include "../s21_parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_array.h"
+#include "../s21_vector.h"
+
+namespace s21 {
+// large enough to go past kSequentialCutoff and split many times
+static constexpr size_t kLarge = 300'000;
+
+static Vector<uint64_t> random_values(size_t n, uint64_t range) {
+  std::mt19937_64 random(n);
+  Vector<uint64_t> values(n);
+  for (size_t i = 0; i < n; ++i) values[i] = random() % range;
+  return values;
+}
+
+TEST(ParallelTest, SortMatchesStd) {
+  ThreadPool pool(4);
+  for (uint64_t range : {uint64_t{3}, uint64_t{1000}, ~uint64_t{0}}) {
+    Vector<uint64_t> values = random_values(kLarge, range);
+    std::vector<uint64_t> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    parallel::sort(pool, values.begin(), values.end());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  }
+}
+
+TEST(ParallelTest, SortSortedAndReversed) {
+  ThreadPool pool(3);
+  Vector<int> values(kLarge);
+  std::iota(values.begin(), values.end(), 0);
+  parallel::sort(pool, values.begin(), values.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+  parallel::sort(pool, values.begin(), values.end());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  EXPECT_EQ(values[0], 0);
+  EXPECT_EQ(values[kLarge - 1], static_cast<int>(kLarge - 1));
+}
+
+TEST(ParallelTest, SortSmallAndEmpty) {
+  Vector<int> empty;
+  parallel::sort(empty.begin(), empty.end());
+  EXPECT_EQ(empty.size(), 0u);
+  Array<int, 6> small = {5, 3, 6, 1, 4, 2};
+  parallel::sort(small.begin(), small.end());
+  EXPECT_TRUE(std::is_sorted(small.begin(), small.end()));
+}
+
+TEST(ParallelTest, SortArray) {
+  static Array<uint64_t, kLarge> values;
+  Vector<uint64_t> source = random_values(kLarge, 1 << 20);
+  std::copy(source.begin(), source.end(), values.begin());
+  parallel::sort(values.begin(), values.end());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST(ParallelTest, SortMovesOnlyTypes) {
+  ThreadPool pool(4);
+  Vector<std::unique_ptr<int>> values(kLarge);
+  for (size_t i = 0; i < kLarge; ++i) {
+    values[i] = std::make_unique<int>(static_cast<int>((i * 7919) % kLarge));
+  }
+  parallel::sort(pool, values.begin(), values.end(),
+                 [](const auto& a, const auto& b) { return *a < *b; });
+  for (size_t i = 0; i < kLarge; ++i) {
+    ASSERT_TRUE(values[i]);
+    ASSERT_EQ(*values[i], static_cast<int>(i));
+  }
+}
+
+TEST(ParallelTest, SortStrings) {
+  ThreadPool pool(2);
+  Vector<uint64_t> keys = random_values(kLarge, 5000);
+  Vector<std::string> values(kLarge);
+  for (size_t i = 0; i < kLarge; ++i) {
+    // longer than the small string buffer
+    values[i] = std::string(24, 'k') + std::to_string(keys[i]);
+  }
+  std::vector<std::string> expected(values.begin(), values.end());
+  std::sort(expected.begin(), expected.end());
+  parallel::sort(pool, values.begin(), values.end());
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(ParallelTest, PartitionMatchesStd) {
+  ThreadPool pool(4);
+  for (uint64_t range : {uint64_t{2}, uint64_t{100}}) {
+    for (size_t grain : {size_t{1}, size_t{7}, size_t{4096}}) {
+      Vector<uint64_t> values = random_values(kLarge / 10 + grain, range);
+      auto odd = [](uint64_t value) { return value % 2 == 1; };
+      size_t expected = std::count_if(values.begin(), values.end(), odd);
+      uint64_t* middle = parallel::internal::partition(
+          pool, values.begin(), values.end(), grain, odd);
+      EXPECT_EQ(static_cast<size_t>(middle - values.begin()), expected);
+      EXPECT_TRUE(std::is_partitioned(values.begin(), values.end(), odd));
+    }
+  }
+}
+
+TEST(ParallelTest, StableSortKeepsOrderOfEqualKeys) {
+  ThreadPool pool(4);
+  Vector<std::pair<int, size_t>> values(kLarge);
+  std::mt19937 random(7);
+  for (size_t i = 0; i < kLarge; ++i) values[i] = {random() % 100, i};
+  auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+  std::vector<std::pair<int, size_t>> expected(values.begin(), values.end());
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  parallel::stable_sort(pool, values.begin(), values.end(), by_key);
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(ParallelTest, StableSortMovesOnlyTypes) {
+  Vector<std::unique_ptr<int>> values(kLarge);
+  for (size_t i = 0; i < kLarge; ++i) {
+    values[i] = std::make_unique<int>(static_cast<int>((i * 7919) % kLarge));
+  }
+  parallel::stable_sort(values.begin(), values.end(),
+                        [](const auto& a, const auto& b) { return *a < *b; });
+  for (size_t i = 0; i < kLarge; ++i) {
+    ASSERT_TRUE(values[i]);
+    ASSERT_EQ(*values[i], static_cast<int>(i));
+  }
+}
+
+// the sorts take any random access iterators, not only pointers
+TEST(ParallelTest, SortsDeque) {
+  ThreadPool pool(3);
+  Vector<uint64_t> source = random_values(kLarge, 1000);
+  std::deque<std::pair<uint64_t, size_t>> values;
+  for (size_t i = 0; i < kLarge; ++i) values.emplace_back(source[i], i);
+  auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+  std::vector<std::pair<uint64_t, size_t>> expected(values.begin(),
+                                                    values.end());
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  parallel::stable_sort(pool, values.begin(), values.end(), by_key);
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  parallel::sort(pool, values.begin(), values.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+
+TEST(ParallelTest, ForEachVisitsEveryElementOnce) {
+  ThreadPool pool(4);
+  Vector<int> values(kLarge);
+  parallel::for_each(pool, values.begin(), values.end(),
+                     [](int& value) { ++value; });
+  EXPECT_TRUE(std::all_of(values.begin(), values.end(),
+                          [](int value) { return value == 1; }));
+  std::atomic<size_t> calls{0};
+  parallel::for_each(values.begin(), values.end(),
+                     [&calls](int) { calls.fetch_add(1); });
+  EXPECT_EQ(calls.load(), kLarge);
+}
+
+TEST(ParallelTest, Transform) {
+  ThreadPool pool(2);
+  Vector<uint64_t> values = random_values(kLarge, 1000);
+  Vector<uint64_t> squares(kLarge);
+  auto square = [](uint64_t value) { return value * value; };
+  auto end = parallel::transform(pool, values.begin(), values.end(),
+                                 squares.begin(), square);
+  EXPECT_EQ(end, squares.end());
+  for (size_t i = 0; i < kLarge; ++i) ASSERT_EQ(squares[i], square(values[i]));
+  parallel::transform(values.begin(), values.end(), values.begin(), square);
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), squares.begin()));
+}
+
+TEST(ParallelTest, Reduce) {
+  ThreadPool pool(4);
+  Vector<uint64_t> values = random_values(kLarge, 1 << 20);
+  uint64_t expected = std::accumulate(values.begin(), values.end(),
+                                      uint64_t{5});
+  EXPECT_EQ(parallel::reduce(pool, values.begin(), values.end(), uint64_t{5}),
+            expected);
+  auto max = [](uint64_t a, uint64_t b) { return std::max(a, b); };
+  EXPECT_EQ(parallel::reduce(values.begin(), values.end(), uint64_t{0}, max),
+            *std::max_element(values.begin(), values.end()));
+  Vector<uint64_t> empty;
+  EXPECT_EQ(parallel::reduce(empty.begin(), empty.end(), uint64_t{9}), 9u);
+}
+
+TEST(ParallelTest, InclusiveScan) {
+  ThreadPool pool(3);
+  Vector<uint64_t> values = random_values(kLarge + 17, 100);
+  std::vector<uint64_t> expected(values.size());
+  std::partial_sum(values.begin(), values.end(), expected.begin());
+  Vector<uint64_t> sums(values.size());
+  auto end = parallel::inclusive_scan(pool, values.begin(), values.end(),
+                                      sums.begin());
+  EXPECT_EQ(end, sums.end());
+  EXPECT_TRUE(std::equal(sums.begin(), sums.end(), expected.begin()));
+  parallel::inclusive_scan(values.begin(), values.end(), values.begin());
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+TEST(ParallelTest, InclusiveScanSmallArray) {
+  Array<int, 5> values = {1, 2, 3, 4, 5};
+  Array<int, 5> sums;
+  parallel::inclusive_scan(values.begin(), values.end(), sums.begin(),
+                           std::multiplies<>());
+  EXPECT_EQ(sums[4], 120);
+}
+
+TEST(ParallelTest, ExceptionsReachTheCaller) {
+  ThreadPool pool(4);
+  Vector<int> values(kLarge);
+  std::iota(values.begin(), values.end(), 0);
+  auto throws = [](int value) {
+    if (value == 123'456) throw std::runtime_error("bad value");
+  };
+  EXPECT_THROW(parallel::for_each(pool, values.begin(), values.end(), throws),
+               std::runtime_error);
+  // the pool is still usable afterwards
+  EXPECT_EQ(parallel::reduce(pool, values.begin(), values.end(), 0L),
+            static_cast<long>(kLarge) * (kLarge - 1) / 2);
+}
+
+TEST(ParallelTest, SingleWorkerPool) {
+  ThreadPool pool(1);
+  Vector<uint64_t> values = random_values(kLarge, 1 << 10);
+  parallel::sort(pool, values.begin(), values.end());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  parallel::stable_sort(pool, values.begin(), values.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+}  // namespace s21
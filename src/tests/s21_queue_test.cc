@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <queue>
 
 #include "../s21_list.h"
@@ -298,4 +299,17 @@ TEST(Suite_Queue, Move_Assignment_Pair) {
     my_queue3.pop();
   }
 }
+TEST(Suite_Queue, Pmr_Queue) {
+  alignas(std::max_align_t) char buf[1024];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Queue<int> q(s21::pmr::List<int>::allocator_type{&r});
+  for (int i = 0; i < 10; ++i) q.push(i);
+  const char *p = reinterpret_cast<const char *>(&q.back());
+  EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  EXPECT_EQ(q.front(), 0);
+  q.pop();
+  EXPECT_EQ(q.front(), 1);
+}
+
 }  // namespace s21
\ No newline at end of file
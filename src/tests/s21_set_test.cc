@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
 // Default constructor
 TEST(SetTest, DefaultConstructor) {
   s21::Set<int> s;
@@ -374,12 +380,17 @@ TEST(IteratorTest, OperatorEqual) {
   ASSERT_EQ(it1, it2);
   ASSERT_NE(it1, it3);
   ASSERT_NE(it1, it4);
+  using Node = s21::Set<int>::Node;
+  delete static_cast<Node*>(root->left->left);
+  delete static_cast<Node*>(root->left);
+  delete root;
 }
 
 TEST(IteratorTest, OperatorDereference) {
   s21::Set<int>::Node* root = new s21::Set<int>::Node(4);
   s21::Set<int>::SetIterator it(root);
   ASSERT_EQ(*it, 4);
+  delete root;
 }
 
 TEST(IteratorTest, OperatorIncrement) {
@@ -413,8 +424,13 @@ TEST(IteratorTest, OperatorIncrementEdgeCases) {
   ASSERT_EQ(it2++, root);
   ASSERT_EQ(++it3, root->left->right);
   ASSERT_EQ(it4++, root->left->left);
-  delete root->left->left;
-  delete root->left->right;
+  // the links are base pointers now, the nodes are deleted as nodes
+  using Node = s21::Set<int>::Node;
+  delete static_cast<Node*>(root->left->left);
+  delete static_cast<Node*>(root->left->right);
+  delete static_cast<Node*>(root->left);
+  delete static_cast<Node*>(root->right);
+  delete root;
 }
 
 TEST(SetTest, insert_many) {
@@ -444,3 +460,233 @@ TEST(SetTest, insert_many_string) {
   EXPECT_FALSE(res3[1].second);
   EXPECT_FALSE(res3[2].second);
 }
+
+TEST(SetTest, nth_and_rank) {
+  s21::Set<int> my_set;
+  for (int i = 0; i < 1000; ++i) my_set.insert((i * 7) % 1000 * 2);
+  EXPECT_EQ(*my_set.nth(0), 0);
+  EXPECT_EQ(*my_set.nth(500), 1000);
+  EXPECT_EQ(*my_set.nth(999), 1998);
+  EXPECT_EQ(my_set.nth(1000), my_set.end());
+  EXPECT_EQ(my_set.rank(0), 0);
+  EXPECT_EQ(my_set.rank(1000), 500);
+  EXPECT_EQ(my_set.rank(1001), 501);
+  EXPECT_EQ(my_set.rank(5000), 1000);
+  EXPECT_EQ(my_set.count_range(10, 20), 5);
+  EXPECT_EQ(my_set.count_range(11, 11), 0);
+  EXPECT_EQ(my_set.count_range(20, 10), 0);
+}
+
+TEST(SetTest, rank_after_erase_and_merge) {
+  s21::Set<int> my_set = {1, 3, 5, 7};
+  s21::Set<int> other = {2, 4, 6, 7};
+  my_set.merge(other);
+  EXPECT_EQ(my_set.size(), 7);
+  for (int i = 1; i <= 7; ++i) EXPECT_EQ(*my_set.nth(i - 1), i);
+  my_set.erase(my_set.find(4));
+  EXPECT_EQ(my_set.rank(5), 3);
+  EXPECT_EQ(*my_set.nth(3), 5);
+  EXPECT_EQ(my_set.count_range(1, 8), 6);
+}
+
+TEST(SetTest, bounds) {
+  s21::Set<int> my_set = {10, 20, 30, 40};
+  EXPECT_EQ(*my_set.lower_bound(20), 20);
+  EXPECT_EQ(*my_set.lower_bound(21), 30);
+  EXPECT_EQ(*my_set.upper_bound(20), 30);
+  EXPECT_EQ(*my_set.upper_bound(5), 10);
+  EXPECT_EQ(my_set.lower_bound(41), my_set.end());
+  EXPECT_EQ(my_set.upper_bound(40), my_set.end());
+  auto range = my_set.equal_range(30);
+  EXPECT_EQ(*range.first, 30);
+  EXPECT_EQ(*range.second, 40);
+  range = my_set.equal_range(25);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(*range.first, 30);
+}
+
+TEST(SetTest, bounds_match_std) {
+  s21::Set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 500; ++i) {
+    my_set.insert((i * 37) % 1000);
+    std_set.insert((i * 37) % 1000);
+  }
+  for (int key = -1; key <= 1001; ++key) {
+    auto lower = my_set.lower_bound(key);
+    auto std_lower = std_set.lower_bound(key);
+    ASSERT_EQ(lower == my_set.end(), std_lower == std_set.end());
+    if (std_lower != std_set.end()) {
+      ASSERT_EQ(*lower, *std_lower);
+    }
+    auto range = my_set.equal_range(key);
+    ASSERT_EQ(range.first, lower);
+    ASSERT_EQ(range.second, my_set.upper_bound(key));
+  }
+}
+
+TEST(SetTest, from_sorted_and_hint) {
+  std::vector<int> keys;
+  for (int i = 0; i < 100; ++i) keys.push_back(i * 2);
+  auto my_set = s21::Set<int>::from_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(my_set.size(), 100);
+  EXPECT_EQ(*my_set.nth(50), 100);
+  auto it = my_set.insert(my_set.find(10), 9);
+  EXPECT_EQ(*it, 9);
+  EXPECT_EQ(*++it, 10);
+  my_set.assign_sorted(keys.begin(), keys.begin() + 3);
+  EXPECT_EQ(my_set.size(), 3);
+  EXPECT_FALSE(my_set.contains(9));
+}
+
+TEST(SetTest, extract_and_insert_node) {
+  s21::Set<std::string> my_set = {"a", "b", "c"};
+  s21::Set<std::string> other;
+  auto handle = my_set.extract("b");
+  EXPECT_EQ(handle.value(), "b");
+  EXPECT_EQ(my_set.size(), 2);
+  handle.value() = "d";
+  auto result = other.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(*result.position, "d");
+  result = other.insert(my_set.extract(my_set.begin()));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(*other.begin(), "a");
+  EXPECT_TRUE(my_set.extract("x").empty());
+  EXPECT_FALSE(other.insert(s21::Set<std::string>::node_type()).inserted);
+}
+
+TEST(SetTest, PmrNodesFromResource) {
+  alignas(std::max_align_t) char buf[4096];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Set<int> s(&r);
+  for (int i = 0; i < 40; ++i) s.insert(i * 7 % 40);
+  EXPECT_EQ(s.size(), 40);
+  for (const int &value : s) {
+    const char *p = reinterpret_cast<const char *>(&value);
+    EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  }
+  EXPECT_EQ(s.get_allocator().resource(), &r);
+}
+
+TEST(SetTest, PmrAcrossResources) {
+  std::pmr::monotonic_buffer_resource r1, r2;
+  s21::pmr::Set<std::string> a({"a", "b"}, &r1);
+  s21::pmr::Set<std::string> b({"b", "c"}, &r2);
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_TRUE(b.empty());
+  b.insert(a.extract("a"));
+  EXPECT_TRUE(b.contains("a"));
+  EXPECT_FALSE(a.contains("a"));
+  a = std::move(b);
+  EXPECT_EQ(a.get_allocator().resource(), &r1);
+  EXPECT_EQ(a.size(), 1);
+  s21::pmr::Set<std::string> copy(a);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_TRUE(copy.contains("a"));
+}
+
+// Sorted input used to degenerate the tree into a list and overflow the
+// stack in the recursive walks; every walk is iterative now.
+TEST(SetTest, TenMillionSortedKeys) {
+  const int n = 10000000;
+  s21::Set<int> s;
+  for (int i = 0; i < n; ++i) s.insert(i);
+  ASSERT_EQ(s.size(), static_cast<size_t>(n));
+  EXPECT_TRUE(s.contains(0));
+  EXPECT_TRUE(s.contains(n - 1));
+  EXPECT_FALSE(s.contains(n));
+  EXPECT_EQ(*s.find(n / 2), n / 2);
+  int expected = 0;
+  for (int value : s) ASSERT_EQ(value, expected++);
+  EXPECT_EQ(expected, n);
+  s.erase(s.find(n / 2));
+  EXPECT_FALSE(s.contains(n / 2));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(SetTest, GreaterOrdersDescending) {
+  s21::Set<int, std::greater<int>> s{3, 1, 4, 1, 5};
+  std::vector<int> values(s.begin(), s.end());
+  EXPECT_EQ(values, std::vector<int>({5, 4, 3, 1}));
+  EXPECT_EQ(*s.lower_bound(2), 1);
+  EXPECT_EQ(*s.upper_bound(4), 3);
+}
+
+// no relational operators at all, only the comparator
+struct Point {
+  int x, y;
+};
+struct PointLess {
+  bool operator()(const Point& a, const Point& b) const {
+    return a.x != b.x ? a.x < b.x : a.y < b.y;
+  }
+};
+
+TEST(SetTest, ComparatorOnlyKeys) {
+  s21::Set<Point, PointLess> s;
+  s.insert({1, 2});
+  s.insert({1, 1});
+  s.insert({0, 5});
+  EXPECT_FALSE(s.insert({1, 1}).second);
+  EXPECT_EQ(s.size(), 3u);
+  EXPECT_TRUE(s.contains({1, 2}));
+  EXPECT_FALSE(s.contains({2, 1}));
+  EXPECT_EQ(s.begin()->x, 0);
+  EXPECT_EQ(s.find({1, 1})->y, 1);
+  s21::Set<Point, PointLess> copy(s);
+  copy.erase(copy.find({1, 2}));
+  EXPECT_EQ(copy.size(), 2u);
+}
+
+TEST(SetTest, TransparentLookup) {
+  s21::Set<std::string, std::less<>> s{"apple", "banana", "cherry"};
+  std::string_view key = "banana";
+  EXPECT_EQ(*s.find(key), "banana");
+  EXPECT_TRUE(s.contains("cherry"));
+  EXPECT_FALSE(s.contains("durian"));
+  EXPECT_EQ(s.find(std::string_view("fig")), s.end());
+  EXPECT_EQ(*s.lower_bound("b"), "banana");
+  EXPECT_EQ(*s.upper_bound("banana"), "cherry");
+  auto range = s.equal_range(key);
+  EXPECT_EQ(std::distance(range.first, range.second), 1);
+}
+
+TEST(SetTest, ReverseIterationAndDecrementEnd) {
+  s21::Set<int> s{4, 1, 3, 2};
+  EXPECT_EQ(*--s.end(), 4);
+  std::vector<int> values(s.rbegin(), s.rend());
+  EXPECT_EQ(values, std::vector<int>({4, 3, 2, 1}));
+  s.erase(s.find(4));
+  EXPECT_EQ(*s.rbegin(), 3);
+  const s21::Set<int>& view = s;
+  EXPECT_EQ(*view.rbegin(), 3);
+  EXPECT_EQ(std::distance(view.rbegin(), view.rend()), 3);
+  s21::Set<int> empty;
+  EXPECT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(SetTest, FrontAndBack) {
+  s21::Set<int> s{4, 1, 3, 2};
+  EXPECT_EQ(s.front(), 1);
+  EXPECT_EQ(s.back(), 4);
+  s.insert(0);
+  s.erase(s.find(4));
+  const s21::Set<int>& view = s;
+  EXPECT_EQ(view.front(), 0);
+  EXPECT_EQ(view.back(), 3);
+}
+
+TEST(SetTest, DebugStats) {
+  s21::Set<int> s = {4, 2, 6, 1, 3, 5, 7};
+  s21::TreeDebugStats stats = s.debug_stats();
+  EXPECT_EQ(stats.node_count, 7u);
+  EXPECT_EQ(stats.height, 3u);
+  EXPECT_EQ(stats.depth_histogram, std::vector<size_t>({1, 2, 4}));
+  EXPECT_DOUBLE_EQ(stats.average_depth, 10.0 / 7);
+  EXPECT_DOUBLE_EQ(s.sampled_depth(7), stats.average_depth);
+}
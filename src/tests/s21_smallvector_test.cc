@@ -0,0 +1,158 @@
+#include "../s21_smallvector.h"
+
+#include <gtest/gtest.h>
+
+//--------------------------------------------------------------------
+// inline storage
+//--------------------------------------------------------------------
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+  s21::SmallVector<int, 4> v;
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(SmallVectorTest, ShrinkToFitMovesBackInline) {
+  s21::SmallVector<std::string, 2> v = {"a", "b", "c"};
+  EXPECT_FALSE(v.is_inline());
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 2);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "b");
+}
+
+TEST(SmallVectorTest, ReserveAndResize) {
+  s21::SmallVector<int, 4> v(3);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], 0);
+  v.reserve(2);
+  EXPECT_TRUE(v.is_inline());
+  v.reserve(100);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 100);
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_THROW(v.reserve(v.max_size() + 1), std::bad_alloc);
+}
+
+struct alignas(64) CacheLine {
+  int value;
+};
+
+TEST(SmallVectorTest, HeapStorageKeepsOverAlignment) {
+  s21::SmallVector<CacheLine, 2> v;
+  for (int i = 0; i < 10; ++i) v.push_back({i});
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % 64, 0u);
+  CacheLine more[] = {{10}, {11}, {12}, {13}, {14}, {15}, {16}};
+  v.insert(v.begin() + 5, std::begin(more), std::end(more));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % 64, 0u);
+  int expected[] = {0, 1, 2, 3, 4, 10, 11, 12, 13, 14, 15, 16, 5, 6, 7, 8, 9};
+  ASSERT_EQ(v.size(), std::size(expected));
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i].value, expected[i]);
+}
+
+//--------------------------------------------------------------------
+// copy / move / swap
+//--------------------------------------------------------------------
+
+TEST(SmallVectorTest, CopyInlineAndHeap) {
+  s21::SmallVector<std::string, 2> small = {"x"};
+  s21::SmallVector<std::string, 2> big = {"a", "b", "c"};
+  s21::SmallVector<std::string, 2> small_copy(small);
+  s21::SmallVector<std::string, 2> big_copy(big);
+  EXPECT_TRUE(small_copy.is_inline());
+  EXPECT_FALSE(big_copy.is_inline());
+  EXPECT_NE(big_copy.data(), big.data());
+  EXPECT_EQ(small_copy[0], "x");
+  EXPECT_EQ(big_copy[2], "c");
+}
+
+TEST(SmallVectorTest, MoveStealsHeapBuffer) {
+  s21::SmallVector<std::string, 2> v = {"a", "b", "c"};
+  std::string* data = v.data();
+  s21::SmallVector<std::string, 2> moved(std::move(v));
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  v.push_back("d");
+  EXPECT_EQ(v[0], "d");
+}
+
+TEST(SmallVectorTest, MoveInlineElements) {
+  s21::SmallVector<std::string, 4> v = {"a", "b"};
+  s21::SmallVector<std::string, 4> moved;
+  moved.push_back("old");
+  moved = std::move(v);
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(moved[1], "b");
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(SmallVectorTest, SwapMixedStorage) {
+  s21::SmallVector<int, 2> a = {1};
+  s21::SmallVector<int, 2> b = {2, 3, 4};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_FALSE(a.is_inline());
+  EXPECT_EQ(a[2], 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.is_inline());
+  EXPECT_EQ(b[0], 1);
+}
+
+//--------------------------------------------------------------------
+// modifiers
+//--------------------------------------------------------------------
+
+TEST(SmallVectorTest, InsertAndErase) {
+  s21::SmallVector<int, 4> v = {1, 3};
+  auto it = v.insert(v.begin() + 1, 2);
+  EXPECT_EQ(*it, 2);
+  v.erase(v.begin());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v.front(), 2);
+  EXPECT_EQ(v.back(), 3);
+  EXPECT_THROW(v.at(2), std::out_of_range);
+  v.clear();
+  EXPECT_THROW(v.front(), std::out_of_range);
+}
+
+TEST(SmallVectorTest, EmplaceOwnElementWhileSpilling) {
+  s21::SmallVector<std::string, 2> v = {"first", "second"};
+  v.emplace_back(v[0]);
+  v.emplace(v.begin(), 3, 'z');
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "zzz");
+  EXPECT_EQ(v[3], "first");
+}
+
+TEST(SmallVectorTest, InsertMany) {
+  s21::SmallVector<std::string, 4> v = {"hello", "world"};
+  auto it = v.insert_many(v.begin() + 1, "this", "is", "a");
+  EXPECT_EQ(*it, "a");
+  v.insert_many_back("!", "!");
+  s21::SmallVector<std::string, 4> expected = {"hello", "this", "is", "a",
+                                               "world", "!",    "!"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(SmallVectorTest, InsertRangeAndAppend) {
+  s21::SmallVector<int, 4> v = {1, 5};
+  std::list<int> src = {2, 3, 4};
+  v.insert(v.begin() + 1, src.begin(), src.end());
+  v.append_range(src);
+  int expected[] = {1, 2, 3, 4, 5, 2, 3, 4};
+  ASSERT_EQ(v.size(), 8);
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
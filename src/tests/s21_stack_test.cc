@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <stack>
 
 #include "../s21_list.h"
@@ -363,4 +364,16 @@ TEST(Suite_Stack, insert_many_front_Test) {
   EXPECT_EQ(my_stack.size(), 3u);
   EXPECT_EQ(my_stack.top(), 4u);
 }
+TEST(Suite_Stack, Pmr_Stack) {
+  alignas(std::max_align_t) char buf[1024];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Stack<int> s(s21::pmr::List<int>::allocator_type{&r});
+  for (int i = 0; i < 10; ++i) s.push(i);
+  const char *p = reinterpret_cast<const char *>(&s.top());
+  EXPECT_TRUE(p >= buf && p < buf + sizeof buf);
+  EXPECT_EQ(s.top(), 9);
+  EXPECT_EQ(s.size(), 10u);
+}
+
 }  // namespace s21
\ No newline at end of file
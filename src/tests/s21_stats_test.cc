@@ -0,0 +1,255 @@
+#include "../s21_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_btree_map.h"
+#include "../s21_concurrent_queue.h"
+#include "../s21_flat_set.h"
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "../s21_smallvector.h"
+#include "../s21_unordered_map.h"
+#include "../s21_vector.h"
+
+using s21::stats::Kind;
+
+// the counters are global, so every test starts from zero
+class StatsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!s21::stats::kEnabled) GTEST_SKIP() << "built without S21_STATS";
+    s21::stats::reset();
+  }
+};
+
+TEST_F(StatsTest, VectorGrowth) {
+  {
+    s21::Vector<int> v;
+    for (int i = 0; i < 8; ++i) v.push_back(i);
+    auto vector = s21::stats::snapshot()[Kind::kVector];
+    EXPECT_EQ(vector.allocations, 4u);  // capacities 1, 2, 4 and 8
+    EXPECT_EQ(vector.reallocations, 3u);
+    EXPECT_EQ(vector.frees, 3u);
+    EXPECT_EQ(vector.bytes_allocated, 15 * sizeof(int));
+    EXPECT_EQ(vector.copies, 8u);
+    EXPECT_EQ(vector.moves, 1u + 2u + 4u + 4u);  // relocated, then appended
+  }
+  auto vector = s21::stats::snapshot()[Kind::kVector];
+  EXPECT_EQ(vector.frees, vector.allocations);
+  EXPECT_EQ(vector.bytes_freed, vector.bytes_allocated);
+}
+
+TEST_F(StatsTest, ReserveAvoidsReallocations) {
+  s21::Vector<int> v;
+  v.reserve(100);
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  auto vector = s21::stats::snapshot()[Kind::kVector];
+  EXPECT_EQ(vector.allocations, 1u);
+  EXPECT_EQ(vector.reallocations, 0u);
+  EXPECT_EQ(vector.moves, 0u);
+}
+
+TEST_F(StatsTest, CopiesAndMoves) {
+  s21::Vector<std::string> v;
+  v.reserve(4);
+  std::string s(32, 'x');
+  v.push_back(s);
+  v.push_back(std::move(s));
+  v.emplace_back(3, 'y');  // built in place
+  auto vector = s21::stats::snapshot()[Kind::kVector];
+  EXPECT_EQ(vector.copies, 1u);
+  EXPECT_EQ(vector.moves, 1u);
+  s21::Vector<std::string> copy(v);
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kVector].copies, 4u);
+}
+
+TEST_F(StatsTest, ListNodes) {
+  {
+    s21::List<int> l;
+    for (int i = 0; i < 10; ++i) l.push_back(i);
+    auto list = s21::stats::snapshot()[Kind::kList];
+    EXPECT_EQ(list.allocations, 11u);  // and the end sentinel
+    EXPECT_EQ(list.copies, 10u);
+    l.pop_front();
+    EXPECT_EQ(s21::stats::snapshot()[Kind::kList].frees, 1u);
+  }
+  auto list = s21::stats::snapshot()[Kind::kList];
+  EXPECT_EQ(list.frees, 11u);
+  EXPECT_EQ(list.bytes_freed, list.bytes_allocated);
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kVector].allocations, 0u);
+}
+
+TEST_F(StatsTest, TreeComparisonsPerLookup) {
+  s21::Set<int> s;
+  for (int i = 0; i < 1023; ++i) s.insert(i);
+  auto tree = s21::stats::snapshot()[Kind::kTree];
+  EXPECT_EQ(tree.allocations, 1023u);
+  EXPECT_EQ(tree.copies, 1023u);
+  s21::stats::reset();
+  for (int i = 0; i < 1023; ++i) ASSERT_TRUE(s.contains(i));
+  tree = s21::stats::snapshot()[Kind::kTree];
+  EXPECT_EQ(tree.lookups, 1023u);
+  // a red-black tree of 1023 nodes is at most 18 levels deep, and a found
+  // key costs one more comparison
+  EXPECT_GE(tree.comparisons_per_lookup(), 9.0);
+  EXPECT_LE(tree.comparisons_per_lookup(), 19.0);
+}
+
+// a right hint and a sorted load skip the descent, but not the comparisons
+TEST_F(StatsTest, TreeHintedInsertAndSortedLoad) {
+  s21::Set<int> s = {0};
+  s21::stats::reset();
+  for (int i = 1; i <= 100; ++i) s.insert(s.end(), i);
+  auto tree = s21::stats::snapshot()[Kind::kTree];
+  EXPECT_EQ(tree.lookups, 0u);
+  EXPECT_EQ(tree.comparisons, 100u);
+  auto fifty = s.find(50);
+  s21::stats::reset();
+  s.insert(fifty, 50);  // already there
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kTree].comparisons, 2u);
+  s21::Vector<int> sorted(100);
+  for (int i = 0; i < 100; ++i) sorted[i] = i;
+  s21::stats::reset();
+  s.assign_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kTree].comparisons, 99u);
+}
+
+TEST_F(StatsTest, MapInsertAndLookup) {
+  s21::Map<int, std::string> m;
+  m.insert(1, "one");
+  m[2] = "two";
+  EXPECT_EQ(m.at(1), "one");
+  auto tree = s21::stats::snapshot()[Kind::kTree];
+  EXPECT_EQ(tree.allocations, 2u);
+  EXPECT_GE(tree.lookups, 3u);
+  EXPECT_GT(tree.comparisons, 0u);
+}
+
+TEST_F(StatsTest, SmallVectorStaysInline) {
+  s21::SmallVector<int, 4> v;
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kSmallVector].allocations, 0u);
+  v.push_back(4);
+  auto small = s21::stats::snapshot()[Kind::kSmallVector];
+  EXPECT_EQ(small.allocations, 1u);
+  EXPECT_EQ(small.reallocations, 1u);
+  EXPECT_EQ(small.bytes_allocated, 8 * sizeof(int));
+}
+
+TEST_F(StatsTest, UnorderedMapRehashes) {
+  s21::UnorderedMap<int, int> m;
+  for (int i = 0; i < 100; ++i) m.insert({i, i});
+  auto hash = s21::stats::snapshot()[Kind::kUnorderedMap];
+  EXPECT_GT(hash.reallocations, 0u);
+  EXPECT_EQ(hash.copies, 100u);
+  EXPECT_GT(hash.moves, 0u);
+  s21::stats::reset();
+  s21::UnorderedMap<int, int> reserved;
+  reserved.reserve(100);
+  for (int i = 0; i < 100; ++i) reserved.insert({i, i});
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kUnorderedMap].reallocations, 0u);
+}
+
+TEST_F(StatsTest, BTreeMapNodes) {
+  {
+    s21::BTreeMap<int, int> map;
+    for (int i = 0; i < 1000; ++i) map.insert(i, i);
+    auto btree = s21::stats::snapshot()[Kind::kBTreeMap];
+    EXPECT_GT(btree.allocations, 1u);  // the leaves split
+    EXPECT_GE(btree.copies, 2000u);  // every key and value, and separators
+    EXPECT_EQ(btree.lookups, 999u);   // the first insert has no root yet
+    s21::stats::reset();
+    EXPECT_TRUE(map.contains(500));
+    btree = s21::stats::snapshot()[Kind::kBTreeMap];
+    EXPECT_EQ(btree.lookups, 1u);
+    EXPECT_GT(btree.comparisons, 0u);
+    for (int i = 0; i < 1000; ++i) map.erase(i);
+  }
+  auto btree = s21::stats::snapshot()[Kind::kBTreeMap];
+  EXPECT_GT(btree.frees, 0u);
+}
+
+TEST_F(StatsTest, FlatSetSearches) {
+  s21::FlatSet<int> set;
+  for (int i = 0; i < 64; ++i) set.insert(i);
+  s21::stats::reset();
+  EXPECT_TRUE(set.contains(17));
+  auto flat = s21::stats::snapshot()[Kind::kFlatTree];
+  EXPECT_EQ(flat.lookups, 1u);
+  EXPECT_EQ(flat.comparisons, 6u);  // a binary search over 64 elements
+  // the elements themselves live in a Vector
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kVector].allocations, 0u);
+}
+
+TEST_F(StatsTest, ConcurrentQueueCells) {
+  {
+    s21::ConcurrentQueue<std::string> queue(8);
+    std::string s(32, 'x');
+    queue.try_push(s);
+    queue.try_push(std::move(s));
+    std::string out[2];
+    EXPECT_EQ(queue.pop_bulk(out, 2), 2u);
+    auto counters = s21::stats::snapshot()[Kind::kConcurrentQueue];
+    EXPECT_EQ(counters.allocations, 1u);  // the ring, once
+    EXPECT_EQ(counters.copies, 1u);
+    EXPECT_EQ(counters.moves, 4u);  // both pushes and both pops
+  }
+  auto counters = s21::stats::snapshot()[Kind::kConcurrentQueue];
+  EXPECT_EQ(counters.frees, 1u);
+  EXPECT_EQ(counters.bytes_freed, counters.bytes_allocated);
+}
+
+// every thread counts into its own block, and the blocks of threads that
+// have exited are kept
+TEST_F(StatsTest, SumsEveryThread) {
+  auto work = [] {
+    s21::Vector<int> v;
+    v.reserve(8);
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) threads.emplace_back(work);
+  for (auto& thread : threads) thread.join();
+  work();
+  auto vector = s21::stats::snapshot()[Kind::kVector];
+  EXPECT_EQ(vector.allocations, 5u);
+  EXPECT_EQ(vector.frees, 5u);
+  EXPECT_EQ(vector.bytes_allocated, 5 * 8 * sizeof(int));
+}
+
+TEST_F(StatsTest, ResetReachesRunningThreads) {
+  std::atomic<int> stage{0};
+  std::thread other([&stage] {
+    s21::Vector<int> v;
+    v.reserve(4);
+    stage = 1;
+    while (stage != 2) std::this_thread::yield();
+    v.reserve(16);
+  });
+  while (stage != 1) std::this_thread::yield();
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kVector].allocations, 1u);
+  s21::stats::reset();
+  EXPECT_EQ(s21::stats::snapshot()[Kind::kVector].allocations, 0u);
+  stage = 2;
+  other.join();
+  auto vector = s21::stats::snapshot()[Kind::kVector];
+  EXPECT_EQ(vector.allocations, 1u);
+  EXPECT_EQ(vector.frees, 2u);  // the reserve(4) buffer, then the last one
+}
+
+TEST_F(StatsTest, ResetClearsEverything) {
+  s21::Vector<int> v = {1, 2, 3};
+  s21::Set<int> s = {1, 2, 3};
+  s21::stats::reset();
+  auto snapshot = s21::stats::snapshot();
+  for (const auto& counters : snapshot.kinds) {
+    EXPECT_EQ(counters.allocations, 0u);
+    EXPECT_EQ(counters.copies, 0u);
+    EXPECT_EQ(counters.lookups, 0u);
+  }
+  EXPECT_STREQ(s21::stats::name(Kind::kTree), "tree");
+}
@@ -0,0 +1,87 @@
+#include "../s21_thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+static long fib(ThreadPool& pool, int n) {
+  if (n < 2) return n;
+  if (n < 12) return fib(pool, n - 1) + fib(pool, n - 2);
+  long a = 0, b = 0;
+  pool.parallel_invoke([&] { a = fib(pool, n - 1); },
+                       [&] { b = fib(pool, n - 2); });
+  return a + b;
+}
+
+// the caller runs the tasks itself when there are no workers
+TEST(ThreadPoolTest, NoWorkers) {
+  ThreadPool pool(0);
+  EXPECT_EQ(pool.thread_count(), 0u);
+  EXPECT_EQ(fib(pool, 20), 6765);
+}
+
+TEST(ThreadPoolTest, DefaultLeavesACoreToTheCaller) {
+  size_t cores = std::max(1u, std::thread::hardware_concurrency());
+  EXPECT_EQ(ThreadPool::default_thread_count(), std::max<size_t>(cores - 1, 1));
+}
+
+TEST(ThreadPoolTest, RunsEveryCall) {
+  ThreadPool pool(3);
+  EXPECT_EQ(pool.thread_count(), 3u);
+  std::vector<int> hits(5, 0);
+  pool.parallel_invoke([&] { ++hits[0]; }, [&] { ++hits[1]; },
+                       [&] { ++hits[2]; }, [&] { ++hits[3]; },
+                       [&] { ++hits[4]; });
+  EXPECT_EQ(hits, std::vector<int>(5, 1));
+  int single = 0;
+  pool.parallel_invoke([&] { single = 7; });
+  EXPECT_EQ(single, 7);
+}
+
+TEST(ThreadPoolTest, NestedForkJoin) {
+  ThreadPool pool(4);
+  EXPECT_EQ(fib(pool, 25), 75025);
+  ThreadPool lone(1);
+  EXPECT_EQ(fib(lone, 20), 6765);
+}
+
+TEST(ThreadPoolTest, CallsFromSeveralOutsideThreads) {
+  ThreadPool pool(2);
+  std::vector<long> results(4, 0);
+  std::vector<std::thread> callers;
+  for (int t = 0; t < 4; ++t) {
+    callers.emplace_back([&, t] { results[t] = fib(pool, 18 + t); });
+  }
+  for (auto& caller : callers) caller.join();
+  EXPECT_EQ(results, std::vector<long>({2584, 4181, 6765, 10946}));
+}
+
+TEST(ThreadPoolTest, RethrowsAfterEveryCallFinished) {
+  ThreadPool pool(2);
+  std::atomic<int> finished{0};
+  auto slow = [&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ++finished;
+  };
+  EXPECT_THROW(pool.parallel_invoke(
+                   [] { throw std::runtime_error("first"); }, slow, slow),
+               std::runtime_error);
+  EXPECT_EQ(finished.load(), 2);
+  EXPECT_THROW(
+      pool.parallel_invoke(slow, [] { throw std::logic_error("forked"); }),
+      std::logic_error);
+  EXPECT_EQ(finished.load(), 3);
+}
+
+TEST(ThreadPoolTest, IdleWorkersWakeUp) {
+  ThreadPool pool(2);
+  for (int round = 0; round < 3; ++round) {
+    // long enough for the workers to go to sleep in between
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(fib(pool, 20), 6765);
+  }
+}
+}  // namespace s21
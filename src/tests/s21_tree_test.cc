@@ -0,0 +1,392 @@
+#include "../s21_tree.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+using IntTree = s21::Tree<int, int, s21::KeyIdentity<int>>;
+
+// returns the black height of the subtree or -1 if a red-black rule is broken
+static int black_height(const s21::TreeNodeBase* node) {
+  if (!node) return 1;
+  if (node->left && node->left->parent != node) return -1;
+  if (node->right && node->right->parent != node) return -1;
+  if (node->red && ((node->left && node->left->red) ||
+                    (node->right && node->right->red)))
+    return -1;
+#if S21_TREE_SUBTREE_SIZE
+  size_t count = 1 + (node->left ? node->left->count : 0) +
+                 (node->right ? node->right->count : 0);
+  if (node->count != count) return -1;
+#endif
+  int left = black_height(node->left);
+  int right = black_height(node->right);
+  if (left < 0 || left != right) return -1;
+  return left + (node->red ? 0 : 1);
+}
+
+template <typename Node>
+static int height(const Node* node) {
+  if (!node) return 0;
+  return 1 + std::max(height(node->left), height(node->right));
+}
+
+// the root hangs under the header, which caches the two extreme nodes
+static bool header_is_valid(const IntTree& tree) {
+  const s21::TreeNodeBase* root = tree.root();
+  if (!root) return tree.begin() == tree.end();
+  const s21::TreeNodeBase* first = root;
+  const s21::TreeNodeBase* last = root;
+  while (first->left) first = first->left;
+  while (last->right) last = last->right;
+  return root->parent == tree.end().current() &&
+         tree.begin().current() == first &&
+         std::prev(tree.end()).current() == last;
+}
+
+static bool is_valid(const IntTree& tree) {
+  return !(tree.root() && tree.root()->red) && black_height(tree.root()) > 0 &&
+         header_is_valid(tree);
+}
+
+TEST(TreeTest, SortedInsertStaysBalanced) {
+  IntTree tree;
+  const int n = 100000;
+  for (int i = 0; i < n; ++i) tree.insert_unique(i);
+  ASSERT_EQ(tree.size(), static_cast<size_t>(n));
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_LE(height(tree.root()), 2 * std::log2(n + 1));
+  int expected = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it) {
+    ASSERT_EQ(*it, expected++);
+  }
+}
+
+TEST(TreeTest, ReverseInsertStaysBalanced) {
+  IntTree tree;
+  const int n = 100000;
+  for (int i = n; i > 0; --i) tree.insert_unique(i);
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_LE(height(tree.root()), 2 * std::log2(n + 1));
+}
+
+TEST(TreeTest, EraseKeepsInvariants) {
+  IntTree tree;
+  std::set<int> expected;
+  srand(21);
+  for (int i = 0; i < 5000; ++i) {
+    int key = rand() % 2000;
+    if (rand() % 3) {
+      tree.insert_unique(key);
+      expected.insert(key);
+    } else {
+      tree.erase(tree.find(key));
+      expected.erase(key);
+    }
+    ASSERT_TRUE(is_valid(tree));
+  }
+  ASSERT_EQ(tree.size(), expected.size());
+  auto it = tree.begin();
+  for (int key : expected) {
+    ASSERT_EQ(*it, key);
+    ++it;
+  }
+  EXPECT_EQ(it, tree.end());
+}
+
+TEST(TreeTest, EraseAllSorted) {
+  IntTree tree;
+  for (int i = 0; i < 1000; ++i) tree.insert_unique(i);
+  for (int i = 0; i < 1000; ++i) {
+    tree.erase(tree.find(i));
+    ASSERT_TRUE(is_valid(tree));
+  }
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(TreeTest, InsertEqualKeepsOrderAndCount) {
+  IntTree tree;
+  for (int i = 0; i < 1000; ++i) tree.insert_equal(i % 10);
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_EQ(tree.size(), 1000u);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(tree.count(i), 100u);
+  EXPECT_EQ(tree.count(10), 0u);
+}
+
+TEST(TreeTest, DecrementEnd) {
+  IntTree tree;
+  for (int i = 0; i < 10; ++i) tree.insert_unique(i);
+  auto it = tree.end();
+  --it;
+  EXPECT_EQ(*it, 9);
+  --it;
+  EXPECT_EQ(*it, 8);
+}
+
+TEST(TreeTest, WalksBothWaysThroughTheHeader) {
+  IntTree tree;
+  EXPECT_EQ(tree.rbegin(), tree.rend());
+  tree.insert_unique(5);  // the root is both ends
+  EXPECT_EQ(*tree.rbegin(), 5);
+  EXPECT_EQ(++tree.begin(), tree.end());
+  for (int i = 0; i < 100; ++i) tree.insert_unique((i * 7) % 100);
+  std::vector<int> backwards(tree.rbegin(), tree.rend());
+  ASSERT_EQ(backwards.size(), 100u);
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(backwards[i], 99 - i);
+  auto it = tree.begin();
+  for (int i = 0; i < 100; ++i) ++it;
+  EXPECT_EQ(it, tree.end());
+  for (int i = 99; i >= 0; --i) ASSERT_EQ(*--it, i);
+  EXPECT_EQ(it, tree.begin());
+}
+
+TEST(TreeTest, MoveAndSwapKeepTheHeaders) {
+  IntTree tree;
+  IntTree empty;
+  for (int i = 0; i < 50; ++i) tree.insert_unique(i);
+  auto last = std::prev(tree.end());
+  IntTree moved(std::move(tree));
+  EXPECT_TRUE(is_valid(moved));
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(std::prev(moved.end()), last);  // iterators to nodes stay valid
+  moved.swap(empty);
+  EXPECT_TRUE(is_valid(moved));
+  EXPECT_TRUE(is_valid(empty));
+  EXPECT_EQ(*empty.rbegin(), 49);
+  EXPECT_EQ(moved.begin(), moved.end());
+  tree = std::move(empty);
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_EQ(*tree.begin(), 0);
+  tree.insert_unique(-1);
+  tree.insert_unique(100);
+  EXPECT_EQ(*tree.begin(), -1);
+  EXPECT_EQ(*tree.rbegin(), 100);
+  tree.clear();
+  EXPECT_TRUE(is_valid(tree));
+}
+
+TEST(TreeTest, CopyKeepsShape) {
+  IntTree tree;
+  for (int i = 0; i < 1000; ++i) tree.insert_unique(i);
+  IntTree copy(tree);
+  EXPECT_TRUE(is_valid(copy));
+  EXPECT_EQ(height(copy.root()), height(tree.root()));
+  EXPECT_EQ(copy.size(), tree.size());
+  auto it = copy.begin();
+  for (auto jt = tree.begin(); jt != tree.end(); ++jt, ++it) {
+    EXPECT_EQ(*it, *jt);
+  }
+}
+
+TEST(TreeTest, OrderStatisticsAfterChurn) {
+  IntTree tree;
+  std::multiset<int> expected;
+  srand(7);
+  for (int i = 0; i < 4000; ++i) {
+    int key = rand() % 500;
+    if (rand() % 3) {
+      tree.insert_equal(key);
+      expected.insert(key);
+    } else if (expected.count(key)) {
+      tree.erase(tree.find(key));
+      expected.erase(expected.find(key));
+    }
+  }
+  ASSERT_TRUE(is_valid(tree));
+  ASSERT_EQ(tree.size(), expected.size());
+  size_t k = 0;
+  for (int key : expected) {
+    ASSERT_EQ(tree.nth_node(k++)->value, key);
+  }
+  EXPECT_EQ(tree.nth_node(k), nullptr);
+  for (int key = -1; key <= 501; key += 3) {
+    auto lower = expected.lower_bound(key);
+    ASSERT_EQ(tree.rank(key),
+              static_cast<size_t>(std::distance(expected.begin(), lower)));
+    ASSERT_EQ(tree.count(key), expected.count(key));
+    ASSERT_EQ(tree.count_range(key, key + 50),
+              static_cast<size_t>(
+                  std::distance(lower, expected.lower_bound(key + 50))));
+  }
+}
+
+TEST(TreeTest, AssignSortedIsBalanced) {
+  for (int n = 0; n < 130; ++n) {
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = i * 2;
+    IntTree tree;
+    tree.insert_unique(-1);
+    tree.assign_sorted(keys.begin(), keys.end(), true);
+    ASSERT_EQ(tree.size(), static_cast<size_t>(n));
+    ASSERT_TRUE(is_valid(tree));
+    ASSERT_TRUE(std::equal(tree.begin(), tree.end(), keys.begin()));
+    // the result still rebalances like any other tree
+    for (int i = 0; i < n; ++i) tree.insert_unique(i * 2 + 1);
+    for (int i = 0; i < n; i += 3) tree.erase(tree.find(i));
+    ASSERT_TRUE(is_valid(tree));
+  }
+}
+
+TEST(TreeTest, AssignSortedFallsBackOnUnsortedInput) {
+  std::vector<int> dups = {1, 2, 2, 3};
+  IntTree tree;
+  tree.assign_sorted(dups.begin(), dups.end(), false);
+  EXPECT_EQ(tree.size(), 4u);
+  EXPECT_EQ(tree.count(2), 2u);
+  tree.assign_sorted(dups.begin(), dups.end(), true);
+  EXPECT_EQ(tree.size(), 3u);
+  std::vector<int> shuffled = {5, 1, 4, 1, 3};
+  tree.assign_sorted(shuffled.begin(), shuffled.end(), true);
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_EQ(*tree.begin(), 1);
+  EXPECT_EQ(tree.size(), 4u);
+}
+
+TEST(TreeTest, HintedInsert) {
+  IntTree tree;
+  for (int i = 0; i < 1000; ++i) tree.insert_unique(tree.end(), i * 3);
+  EXPECT_TRUE(is_valid(tree));
+  // right, wrong and duplicate hints all land in the same place
+  auto it = tree.insert_unique(tree.find(30), 29);
+  EXPECT_EQ(*it, 29);
+  it = tree.insert_unique(tree.find(30), 31);
+  EXPECT_EQ(*it, 31);
+  it = tree.insert_unique(tree.begin(), 2000);
+  EXPECT_EQ(*it, 2000);
+  it = tree.insert_unique(tree.end(), -5);
+  EXPECT_EQ(*it, -5);
+  it = tree.insert_unique(tree.find(33), 33);
+  EXPECT_EQ(*it, 33);
+  EXPECT_EQ(tree.size(), 1004u);
+  EXPECT_TRUE(is_valid(tree));
+  std::vector<int> keys(tree.begin(), tree.end());
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+}
+
+TEST(TreeTest, ExtractAndReinsertNodes) {
+  IntTree tree;
+  IntTree other;
+  for (int i = 0; i < 200; ++i) tree.insert_unique(i);
+  const int* address = &*tree.find(50);
+  auto handle = tree.extract(50);
+  ASSERT_FALSE(handle.empty());
+  EXPECT_EQ(handle.value(), 50);
+  EXPECT_EQ(tree.size(), 199u);
+  EXPECT_FALSE(tree.contains(50));
+  EXPECT_TRUE(is_valid(tree));
+  handle.value() = 500;
+  auto result = other.insert_unique(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, address);
+  EXPECT_TRUE(tree.extract(50).empty());
+  // a rejected node comes back in the result
+  other.insert_unique(7);
+  result = other.insert_unique(tree.extract(tree.find(7)));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), 7);
+  for (int i = 0; i < 200; i += 2) {
+    other.insert_equal(tree.extract(tree.find(i)));
+  }
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_TRUE(is_valid(other));
+  EXPECT_EQ(tree.size() + other.size(), 200u);
+}
+
+TEST(TreeTest, MergeRelinksNodes) {
+  IntTree tree;
+  IntTree other;
+  for (int i = 0; i < 1000; i += 2) tree.insert_unique(i);
+  for (int i = 0; i < 1000; i += 3) other.insert_unique(i);
+  const int* address = &*other.find(999);
+  tree.merge_unique(other);
+  EXPECT_EQ(&*tree.find(999), address);
+  EXPECT_EQ(other.size(), 167u);  // multiples of 6 were in both
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    ASSERT_EQ(*it % 6, 0);
+  }
+  EXPECT_EQ(tree.size(), 667u);
+  EXPECT_TRUE(is_valid(tree));
+  EXPECT_TRUE(is_valid(other));
+  tree.merge_equal(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(tree.size(), 834u);
+  EXPECT_EQ(tree.count(0), 2u);
+  EXPECT_TRUE(is_valid(tree));
+}
+
+struct CountingLess {
+  size_t* calls;
+  bool operator()(int a, int b) const {
+    ++*calls;
+    return a < b;
+  }
+};
+
+TEST(TreeTest, OneComparisonPerLevel) {
+  size_t calls = 0;
+  s21::Tree<int, int, s21::KeyIdentity<int>, CountingLess> tree(
+      CountingLess{&calls});
+  const int n = 1 << 12;
+  for (int i = 0; i < n; ++i) tree.insert_unique((i * 37) % n);
+  ASSERT_EQ(tree.size(), static_cast<size_t>(n));
+  const size_t depth = static_cast<size_t>(height(tree.root()));
+  for (int key : {0, n / 3, n - 1, n}) {
+    calls = 0;
+    tree.find(key);
+    EXPECT_LE(calls, depth + 1);
+    calls = 0;
+    tree.lower_bound(key);
+    EXPECT_LE(calls, depth);
+    calls = 0;
+    tree.insert_unique(key);
+    EXPECT_LE(calls, depth + 2);
+  }
+}
+
+TEST(TreeTest, DebugStatsDescribeTheShape) {
+  IntTree tree;
+  auto empty = tree.debug_stats();
+  EXPECT_EQ(empty.node_count, 0u);
+  EXPECT_EQ(empty.height, 0u);
+  EXPECT_TRUE(empty.depth_histogram.empty());
+  EXPECT_EQ(tree.sampled_depth(), 0.0);
+
+  const int n = 10000;
+  for (int i = 0; i < n; ++i) tree.insert_unique(i);
+  auto stats = tree.debug_stats();
+  EXPECT_EQ(stats.node_count, static_cast<size_t>(n));
+  EXPECT_EQ(stats.height, static_cast<size_t>(height(tree.root())));
+  EXPECT_EQ(stats.max_depth + 1, stats.height);
+  EXPECT_EQ(stats.bytes_used, n * sizeof(IntTree::Node));
+  ASSERT_EQ(stats.depth_histogram.size(), stats.height);
+  EXPECT_EQ(stats.depth_histogram[0], 1u);
+  size_t nodes = 0;
+  double total = 0;
+  for (size_t depth = 0; depth < stats.height; ++depth) {
+    EXPECT_LE(stats.depth_histogram[depth], size_t{1} << depth);
+    nodes += stats.depth_histogram[depth];
+    total += static_cast<double>(depth) * stats.depth_histogram[depth];
+  }
+  EXPECT_EQ(nodes, static_cast<size_t>(n));
+  EXPECT_DOUBLE_EQ(stats.average_depth, total / n);
+  EXPECT_GE(stats.average_depth, std::log2(n) - 2);
+  EXPECT_LE(stats.average_depth, 2 * std::log2(n + 1));
+}
+
+TEST(TreeTest, SampledDepthTracksTheAverage) {
+  IntTree tree;
+  srand(23);
+  for (int i = 0; i < 50000; ++i) tree.insert_unique(rand());
+  double average = tree.debug_stats().average_depth;
+  EXPECT_NEAR(tree.sampled_depth(), average, 1.5);
+  EXPECT_NEAR(tree.sampled_depth(1000), average, 0.5);
+  // more samples than nodes visits each node once
+  IntTree small;
+  for (int i = 0; i < 7; ++i) small.insert_unique(i);
+  EXPECT_DOUBLE_EQ(small.sampled_depth(100),
+                   small.debug_stats().average_depth);
+}
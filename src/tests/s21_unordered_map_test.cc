@@ -0,0 +1,196 @@
+#include "../s21_unordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace s21 {
+// every key lands on the same probe sequence and the same h2
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+
+TEST(UnorderedMapTest, DefaultConstructor) {
+  UnorderedMap<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0u);
+  EXPECT_EQ(m.capacity(), 0u);
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_EQ(m.find(1), nullptr);
+  EXPECT_FALSE(m.contains(1));
+}
+
+TEST(UnorderedMapTest, InitializerList) {
+  UnorderedMap<std::string, int> m = {{"one", 1}, {"two", 2}, {"one", 3}};
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(m.at("one"), 1);
+  EXPECT_EQ(*m.find("two"), 2);
+  EXPECT_THROW(m.at("three"), std::out_of_range);
+}
+
+TEST(UnorderedMapTest, InsertAndAssign) {
+  UnorderedMap<int, std::string> m;
+  auto result = m.insert(1, "a");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->second, "a");
+  result = m.insert({1, "b"});
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "a");
+  result = m.insert_or_assign(1, "c");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(m.at(1), "c");
+  m[2] = "d";
+  m[2] += "e";
+  EXPECT_EQ(m.at(2), "de");
+  EXPECT_EQ(m.size(), 2u);
+}
+
+TEST(UnorderedMapTest, EraseByKeyAndIterator) {
+  UnorderedMap<int, int> m = {{1, 10}, {2, 20}, {3, 30}};
+  EXPECT_EQ(m.erase(2), 1u);
+  EXPECT_EQ(m.erase(2), 0u);
+  m.erase(m.insert(4, 40).first);
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_FALSE(m.contains(4));
+  int sum = 0;
+  for (auto const &item : m) sum += item.second;
+  EXPECT_EQ(sum, 40);
+}
+
+TEST(UnorderedMapTest, GrowsAndIterates) {
+  UnorderedMap<int, int> m;
+  const int n = 10000;
+  for (int i = 0; i < n; ++i) m[i] = i * 2;
+  EXPECT_EQ(m.size(), static_cast<size_t>(n));
+  EXPECT_LE(m.size(), m.capacity() - m.capacity() / 8);
+  long long sum = 0;
+  size_t visited = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++visited) sum += it->second;
+  EXPECT_EQ(visited, m.size());
+  EXPECT_EQ(sum, static_cast<long long>(n) * (n - 1));
+  for (int i = 0; i < n; ++i) ASSERT_EQ(m.at(i), i * 2);
+}
+
+TEST(UnorderedMapTest, InsertValueOfOwnElementAcrossRehash) {
+  UnorderedMap<int, std::string> m;
+  m.insert(0, std::string(40, 'x'));
+  // every growth on the way rehashes while the argument is m.at(0)
+  for (int i = 1; i < 200; ++i) m.insert(i, m.at(0));
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(m.at(i), std::string(40, 'x'));
+  UnorderedMap<int, std::string> other;
+  for (int i = 0; i < 200; ++i) {
+    other.insert_or_assign(i, i ? other.at(i - 1) + "y" : "y");
+  }
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(other.at(i).size(), i + 1u);
+}
+
+TEST(UnorderedMapTest, RandomAgainstStd) {
+  UnorderedMap<int, int> m;
+  std::unordered_map<int, int> expected;
+  std::mt19937 gen(21);
+  for (int i = 0; i < 50000; ++i) {
+    int key = static_cast<int>(gen() % 3000);
+    switch (gen() % 3) {
+      case 0:
+        m.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      case 1:
+        ASSERT_EQ(m.erase(key), expected.erase(key));
+        break;
+      default:
+        ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  for (auto const &item : expected) ASSERT_EQ(m.at(item.first), item.second);
+  // churn through tombstones must not grow the table without bound
+  EXPECT_LE(m.capacity(), 8192u);
+}
+
+TEST(UnorderedMapTest, CollidingHashes) {
+  UnorderedMap<int, int, ConstantHash> m;
+  for (int i = 0; i < 100; ++i) m.insert(i, i);
+  for (int i = 0; i < 100; i += 2) m.erase(i);
+  EXPECT_EQ(m.size(), 50u);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(m.contains(i), i % 2 == 1);
+  m[0] = 7;
+  EXPECT_EQ(m.at(0), 7);
+}
+
+TEST(UnorderedMapTest, CopyMoveSwap) {
+  UnorderedMap<std::string, int> m = {{"a", 1}, {"b", 2}};
+  UnorderedMap<std::string, int> copy(m);
+  copy["c"] = 3;
+  EXPECT_EQ(m.size(), 2u);
+  EXPECT_EQ(copy.size(), 3u);
+  UnorderedMap<std::string, int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at("c"), 3);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 3u);
+  m.swap(moved);
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(moved.size(), 2u);
+  moved = std::move(m);
+  EXPECT_EQ(moved.size(), 3u);
+}
+
+TEST(UnorderedMapTest, MergeMovesMissingKeys) {
+  UnorderedMap<int, std::string> m = {{1, "a"}, {2, "b"}};
+  UnorderedMap<int, std::string> other = {{2, "x"}, {3, "c"}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 3u);
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ(other.size(), 1u);
+  EXPECT_EQ(other.at(2), "x");
+}
+
+TEST(UnorderedMapTest, InsertMany) {
+  UnorderedMap<int, char> m;
+  auto result = m.insert_many(std::pair<const int, char>{1, 'a'},
+                              std::pair<const int, char>{2, 'b'},
+                              std::pair<const int, char>{1, 'c'});
+  EXPECT_EQ(result.size(), 3u);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_TRUE(result[1].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_EQ(m.at(1), 'a');
+}
+
+TEST(UnorderedMapTest, ClearKeepsTable) {
+  UnorderedMap<int, int> m;
+  m.reserve(100);
+  size_t capacity = m.capacity();
+  EXPECT_GE(capacity - capacity / 8, 100u);
+  for (int i = 0; i < 100; ++i) m[i] = i;
+  EXPECT_EQ(m.capacity(), capacity);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.begin(), m.end());
+  EXPECT_EQ(m.capacity(), capacity);
+}
+
+TEST(UnorderedMapTest, GroupMatchesScalar) {
+  int8_t ctrl[hash_internal::kGroupWidth];
+  std::mt19937 gen(7);
+  for (int round = 0; round < 100; ++round) {
+    for (auto &c : ctrl) {
+      int kind = static_cast<int>(gen() % 4);
+      c = kind == 0   ? hash_internal::kEmpty
+          : kind == 1 ? hash_internal::kDeleted
+                      : static_cast<int8_t>(gen() % 4);
+    }
+    hash_internal::Group group(ctrl);
+    hash_internal::ScalarGroup scalar(ctrl);
+    for (int8_t h2 = 0; h2 < 4; ++h2) {
+      ASSERT_EQ(group.match(h2), scalar.match(h2));
+    }
+    ASSERT_EQ(group.match_empty(), scalar.match_empty());
+    ASSERT_EQ(group.match_empty_or_deleted(), scalar.match_empty_or_deleted());
+  }
+}
+}  // namespace s21
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <string>
+
 //--------------------------------------------------------------------
 // constructor()
 //--------------------------------------------------------------------
@@ -628,6 +631,19 @@ TEST(VectorTest, test_erase_2) {
   ASSERT_EQ(v[1], 4);
   ASSERT_EQ(v[2], 5);
 }
+
+// the slot freed at the end must not keep the old last element alive
+TEST(VectorTest, test_erase_then_push_strings) {
+  s21::Vector<std::string> v;
+  for (int i = 0; i < 4; ++i) v.push_back(std::string(24, 'a' + i));
+  v.erase(v.begin());
+  ASSERT_EQ(v.size(), 3);
+  v.push_back(std::string(24, 'e'));
+  ASSERT_EQ(v.size(), 4);
+  ASSERT_EQ(v[0], std::string(24, 'b'));
+  ASSERT_EQ(v[2], std::string(24, 'd'));
+  ASSERT_EQ(v[3], std::string(24, 'e'));
+}
 //--------------------------------------------------------------------
 // insert()
 //--------------------------------------------------------------------
@@ -801,6 +817,216 @@ TEST(VectorTest, test_emplace_8) {
   EXPECT_EQ(v[7], "world");
 }
 
+//--------------------------------------------------------------------
+// emplace_back() / push_back(T&&) / emplace()
+//--------------------------------------------------------------------
+struct CopyCounter {
+  static int copies;
+  static int moves;
+  int value;
+  CopyCounter(int v = 0) : value(v) {}
+  CopyCounter(const CopyCounter& other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter&& other) noexcept : value(other.value) { ++moves; }
+  CopyCounter& operator=(const CopyCounter& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter& operator=(CopyCounter&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+};
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+
+// the move constructor may throw, so reallocation has to copy
+struct ThrowingMove {
+  static int copies;
+  int value;
+  ThrowingMove(int v = 0) : value(v) {}
+  ThrowingMove(const ThrowingMove& other) : value(other.value) { ++copies; }
+  ThrowingMove(ThrowingMove&& other) : value(other.value) {}
+};
+int ThrowingMove::copies = 0;
+
+TEST(VectorTest, test_emplace_back_args) {
+  s21::Vector<std::string> v;
+  v.emplace_back(3, 'a');
+  v.emplace_back("bc");
+  auto& last = v.emplace_back();
+  EXPECT_TRUE(last.empty());
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "aaa");
+  EXPECT_EQ(v[1], "bc");
+}
+
+TEST(VectorTest, test_push_back_rvalue) {
+  s21::Vector<std::string> v;
+  std::string value(100, 'x');
+  v.push_back(std::move(value));
+  EXPECT_TRUE(value.empty());
+  EXPECT_EQ(v[0], std::string(100, 'x'));
+}
+
+TEST(VectorTest, test_push_back_own_element) {
+  s21::Vector<std::string> v = {"first"};
+  for (int i = 0; i < 10; ++i) v.push_back(v[0]);
+  EXPECT_EQ(v.size(), 11);
+  EXPECT_EQ(v[10], "first");
+}
+
+TEST(VectorTest, test_growth_moves_elements) {
+  CopyCounter::copies = CopyCounter::moves = 0;
+  s21::Vector<CopyCounter> v;
+  for (int i = 0; i < 1000; ++i) v.emplace_back(i);
+  v.shrink_to_fit();
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_GT(CopyCounter::moves, 0);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i].value, i);
+}
+
+TEST(VectorTest, test_growth_copies_throwing_move) {
+  ThrowingMove::copies = 0;
+  s21::Vector<ThrowingMove> v;
+  for (int i = 0; i < 4; ++i) v.emplace_back(i);
+  EXPECT_EQ(ThrowingMove::copies, 1 + 2);
+  EXPECT_EQ(v[3].value, 3);
+}
+
+TEST(VectorTest, test_emplace_middle) {
+  s21::Vector<std::pair<int, std::string>> v;
+  v.emplace(v.begin(), 1, "one");
+  v.emplace(v.end(), 3, "three");
+  auto it = v.emplace(v.begin() + 1, 2, "two");
+  EXPECT_EQ(it->first, 2);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0].second, "one");
+  EXPECT_EQ(v[1].second, "two");
+  EXPECT_EQ(v[2].second, "three");
+  EXPECT_THROW(v.emplace(v.end() + 1, 4, "four"), std::out_of_range);
+}
+
+//--------------------------------------------------------------------
+// insert(pos, first, last) / append_range()
+//--------------------------------------------------------------------
+TEST(VectorTest, test_insert_range_grows) {
+  s21::Vector<std::string> v = {"a", "e"};
+  std::list<std::string> src = {"b", "c", "d"};
+  auto it = v.insert(v.begin() + 1, src.begin(), src.end());
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(src.front(), "b");
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(v[i], std::string(1, 'a' + i));
+  }
+}
+
+TEST(VectorTest, test_insert_range_short_tail) {
+  s21::Vector<std::string> v = {"a", "b", "c", "d", "e"};
+  v.reserve(20);
+  std::string src[] = {"x", "y"};
+  auto it = v.insert(v.begin() + 1, std::begin(src), std::end(src));
+  EXPECT_EQ(it, v.begin() + 1);
+  s21::Vector<std::string> expected = {"a", "x", "y", "b", "c", "d", "e"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorTest, test_insert_range_long_tail) {
+  s21::Vector<std::string> v = {"a", "b", "c"};
+  v.reserve(20);
+  std::string src[] = {"x", "y", "z", "w"};
+  v.insert(v.begin() + 2, std::begin(src), std::end(src));
+  s21::Vector<std::string> expected = {"a", "b", "x", "y", "z", "w", "c"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(VectorTest, test_insert_range_input_iterator) {
+  s21::Vector<int> v = {1, 5};
+  std::istringstream in("2 3 4");
+  v.insert(v.begin() + 1, std::istream_iterator<int>(in),
+           std::istream_iterator<int>());
+  ASSERT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(VectorTest, test_insert_range_single_reallocation) {
+  s21::Vector<int> v(1000);
+  s21::Vector<int> src(5000);
+  for (int i = 0; i < 5000; ++i) src[i] = i;
+  v.insert(v.begin() + 500, src.begin(), src.end());
+  EXPECT_EQ(v.size(), 6000);
+  EXPECT_EQ(v.capacity(), 6000);
+  EXPECT_EQ(v[499], 0);
+  EXPECT_EQ(v[500], 0);
+  EXPECT_EQ(v[5499], 4999);
+  EXPECT_THROW(v.insert(v.end() + 1, src.begin(), src.end()),
+               std::out_of_range);
+}
+
+TEST(VectorTest, test_append_range) {
+  s21::Vector<int> v = {1, 2};
+  std::list<int> src = {3, 4, 5};
+  v.append_range(src);
+  v.append_range(std::list<int>());
+  ASSERT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(VectorTest, test_insert_many_own_element) {
+  s21::Vector<std::string> v = {"a", "b"};
+  auto it = v.insert_many(v.begin(), v[1], v[0], v[1]);
+  EXPECT_EQ(*it, "b");
+  s21::Vector<std::string> expected = {"b", "a", "b", "a", "b"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+  v.insert_many_back(v[0], v[1]);
+  EXPECT_EQ(v[5], "b");
+  EXPECT_EQ(v[6], "a");
+}
+
+TEST(VectorTest, test_insert_many_nothing) {
+  s21::Vector<int> v = {1, 2};
+  auto it = v.insert_many(v.begin() + 1);
+  EXPECT_EQ(it, v.begin() + 1);
+  EXPECT_EQ(v.size(), 2);
+}
+
+//--------------------------------------------------------------------
+// pmr
+//--------------------------------------------------------------------
+
+TEST(VectorTest, test_pmr_storage_from_resource) {
+  alignas(std::max_align_t) char buf[1024];
+  std::pmr::monotonic_buffer_resource r(buf, sizeof buf,
+                                        std::pmr::null_memory_resource());
+  s21::pmr::Vector<int> v(&r);
+  for (int i = 0; i < 50; ++i) v.push_back(i);
+  ASSERT_EQ(v.size(), 50);
+  ASSERT_GE(reinterpret_cast<char*>(v.data()), buf);
+  ASSERT_LT(reinterpret_cast<char*>(v.data()), buf + sizeof buf);
+  s21::pmr::Vector<int> copy(v);
+  ASSERT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  ASSERT_EQ(copy[49], 49);
+}
+
+TEST(VectorTest, test_pmr_move_between_resources) {
+  std::pmr::monotonic_buffer_resource r1, r2;
+  s21::pmr::Vector<std::string> a({"one", "two", "three"}, &r1);
+  s21::pmr::Vector<std::string> b(&r2);
+  b = std::move(a);
+  ASSERT_EQ(b.get_allocator().resource(), &r2);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b[2], "three");
+  s21::pmr::Vector<std::string> c(std::move(b));
+  ASSERT_EQ(c.get_allocator().resource(), &r2);
+  ASSERT_EQ(c[0], "one");
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,86 @@
+#include "../s21_work_stealing_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace s21 {
+TEST(WorkStealingDequeTest, OwnerPopsLastThievesStealFirst) {
+  WorkStealingDeque<int> d(4);
+  EXPECT_TRUE(d.empty_approx());
+  for (int i = 0; i < 4; ++i) d.push(i);
+  EXPECT_EQ(d.size_approx(), 4u);
+  int value = -1;
+  ASSERT_TRUE(d.try_pop(value));
+  EXPECT_EQ(value, 3);
+  ASSERT_TRUE(d.try_steal(value));
+  EXPECT_EQ(value, 0);
+  ASSERT_TRUE(d.try_steal(value));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(d.try_pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(d.try_pop(value));
+  EXPECT_FALSE(d.try_steal(value));
+  EXPECT_EQ(value, 2);
+}
+
+TEST(WorkStealingDequeTest, GrowsKeepingOrder) {
+  WorkStealingDeque<int> d(2);
+  EXPECT_EQ(d.capacity(), 2u);
+  int value = 0;
+  d.push(-1);
+  ASSERT_TRUE(d.try_steal(value));  // top is no longer at slot 0
+  for (int i = 0; i < 100; ++i) d.push(i);
+  EXPECT_EQ(d.capacity(), 128u);
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_TRUE(d.try_steal(value));
+    EXPECT_EQ(value, i);
+  }
+  for (int i = 99; i >= 50; --i) {
+    ASSERT_TRUE(d.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_TRUE(d.empty_approx());
+}
+
+TEST(WorkStealingDequeTest, EveryElementTakenOnce) {
+  const int n = 200000;
+  const int thieves = 3;
+  WorkStealingDeque<int> d(16);
+  std::vector<int> taken(n, 0);  // each slot written by a single taker
+  std::atomic<bool> done{false};
+  std::atomic<int> count{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t) {
+    threads.emplace_back([&] {
+      int value;
+      while (!done.load(std::memory_order_acquire)) {
+        if (d.try_steal(value)) {
+          ++taken[value];
+          count.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < n; ++i) {
+    d.push(i);
+    if (i % 3 == 0 && d.try_pop(value)) {
+      ++taken[value];
+      count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  while (d.try_pop(value)) {
+    ++taken[value];
+    count.fetch_add(1, std::memory_order_relaxed);
+  }
+  while (count.load() < n) std::this_thread::yield();
+  done.store(true, std::memory_order_release);
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(count.load(), n);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(taken[i], 1) << i;
+}
+}  // namespace s21